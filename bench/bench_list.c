@@ -0,0 +1,197 @@
+/*
+ * Throughput of the list operations, build with optimizations:
+ *     cc -O2 -std=gnu11 bench/bench_list.c src/list.c src/compact_list.c -o bench_list && ./bench_list [size]
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "../src/list.h"
+#include "../src/compact_list.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+
+/* Global Variables */
+list* list_ptr;
+size_t bench_size = 1000000;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t operations, double ms) {
+    printf("%-28s %10zu ops %10.2f ms %8.1f Mops/s\n", name, operations, ms, (double) operations / ms / 1e3);
+}
+
+static void fill(list* list) {
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        list_push_back(list, &val);
+    }
+}
+
+static int compare_longs(const void* lhs, const void* rhs) {
+    long left = *(const long *) lhs;
+    long right = *(const long *) rhs;
+    return (left > right) - (left < right);
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_list_push_back() {
+    list_init(list_ptr, sizeof(long));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    fill(list_ptr);
+    report("list_push_back", bench_size, elapsed_ms(&start));
+    list_clear(list_ptr);
+}
+
+static void bench_list_append_array() {
+    long* array = (long *) malloc(sizeof(long) * bench_size);
+    for(size_t i = 0; i < bench_size; i++) {
+        array[i] = (long) i;
+    }
+    list_init(list_ptr, sizeof(long));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    list_append_array(list_ptr, array, bench_size);
+    report("list_append_array", bench_size, elapsed_ms(&start));
+    list_clear(list_ptr);
+    free(array);
+}
+
+static void bench_list_traverse() {
+    list_init(list_ptr, sizeof(long));
+    fill(list_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long sum = 0;
+    for(int round = 0; round < 10; round++) {
+        list_for_each(node, list_ptr) {
+            sum += *(long *) node->val;
+        }
+    }
+    report("list_for_each", 10 * bench_size, elapsed_ms(&start));
+    assert(sum == 10 * (long) (bench_size * (bench_size - 1) / 2));
+    list_clear(list_ptr);
+}
+
+static void bench_compact_list_traverse() {
+    compact_list compact;
+    compact_list_init(&compact, sizeof(long));
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        compact_list_push_back(&compact, &val);
+    }
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long sum = 0;
+    for(int round = 0; round < 10; round++) {
+        compact_list_for_each(position, &compact) {
+            sum += *(long *) compact_list_node(&compact, position)->val;
+        }
+    }
+    report("compact_list_for_each", 10 * bench_size, elapsed_ms(&start));
+    assert(sum == 10 * (long) (bench_size * (bench_size - 1) / 2));
+    compact_list_clear(&compact);
+}
+
+static void bench_list_defragment() {
+    list_init(list_ptr, sizeof(long));
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) ((i * 7919) % bench_size);
+        list_push_back(list_ptr, &val);
+    }
+    list_sort(list_ptr, compare_longs);
+    for(int pass = 0; pass < 2; pass++) {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        long sum = 0;
+        for(int round = 0; round < 10; round++) {
+            list_for_each(node, list_ptr) {
+                sum += *(long *) node->val;
+            }
+        }
+        report(pass == 0 ? "list_for_each fragmented" : "list_for_each defragmented", 10 * bench_size, elapsed_ms(&start));
+        assert(sum == 10 * (long) (bench_size * (bench_size - 1) / 2));
+        if (pass == 0) {
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            list_defragment(list_ptr);
+            report("list_defragment", bench_size, elapsed_ms(&start));
+        }
+    }
+    list_clear(list_ptr);
+}
+
+static void bench_list_pop_front() {
+    list_init(list_ptr, sizeof(long));
+    fill(list_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while(!list_is_empty(list_ptr)) {
+        list_pop_front(list_ptr);
+    }
+    report("list_pop_front", bench_size, elapsed_ms(&start));
+}
+
+static void bench_list_churn() {
+    list_init(list_ptr, sizeof(long));
+    list_reserve(list_ptr, 1024);
+    for(long i = 0; i < 1024; i++) {
+        list_push_back(list_ptr, &i);
+    }
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        list_pop_front(list_ptr);
+        list_push_back(list_ptr, &val);
+    }
+    report("list_pop_front+push_back", bench_size, elapsed_ms(&start));
+    list_clear(list_ptr);
+}
+
+static void bench_list_sort() {
+    list_init(list_ptr, sizeof(long));
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) ((i * 7919) % bench_size);
+        list_push_back(list_ptr, &val);
+    }
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    list_sort(list_ptr, compare_longs);
+    report("list_sort", bench_size, elapsed_ms(&start));
+    list_clear(list_ptr);
+}
+
+BenchFunction bench_functions[] = {
+        bench_list_push_back,
+        bench_list_append_array,
+        bench_list_traverse,
+        bench_compact_list_traverse,
+        bench_list_defragment,
+        bench_list_pop_front,
+        bench_list_churn,
+        bench_list_sort
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    list_ptr = (list *) malloc(sizeof(list));
+    for(size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
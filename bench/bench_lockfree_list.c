@@ -0,0 +1,150 @@
+/*
+ * Throughput of a concurrent set from 1 to 64 threads, the lock-free list
+ * against a list behind a mutex, build with optimizations:
+ *     cc -O2 -std=gnu11 -pthread bench/bench_lockfree_list.c src/lockfree_list.c src/list.c \
+ *         -o bench_lockfree_list && ./bench_lockfree_list [operations]
+ * Each thread runs 90% contains, 5% insert and 5% remove over 1024 keys.
+ */
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "../src/lockfree_list.h"
+#include "../src/list.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+typedef void (* SetOperation) (void* handle, int key, unsigned op);
+
+/* Global Variables */
+lockfree_list* lockfree_ptr;
+list* list_ptr;
+pthread_mutex_t list_mutex = PTHREAD_MUTEX_INITIALIZER;
+size_t bench_size = 1000000;
+int key_range = 1024;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t threads, size_t operations, double ms) {
+    printf("%-20s %3zu threads %10zu ops %10.2f ms %8.2f Mops/s\n",
+           name, threads, operations, ms, (double) operations / ms / 1e3);
+}
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static void lockfree_operation(void* handle, int key, unsigned op) {
+    if (op < 90)
+        lockfree_list_contains(lockfree_ptr, handle, &key);
+    else if (op < 95)
+        lockfree_list_insert(lockfree_ptr, handle, &key);
+    else
+        lockfree_list_remove(lockfree_ptr, handle, &key);
+}
+
+static void mutex_operation(void* handle, int key, unsigned op) {
+    pthread_mutex_lock(&list_mutex);
+    if (op < 90)
+        list_index_of(list_ptr, &key);
+    else if (op < 95) {
+        if (list_index_of(list_ptr, &key) == -1)
+            list_push_back(list_ptr, &key);
+    }
+    else
+        list_remove(list_ptr, &key);
+    pthread_mutex_unlock(&list_mutex);
+}
+
+struct worker_args {
+    SetOperation operation;
+    size_t operations;
+    unsigned seed;
+};
+
+static void* worker(void* arg) {
+    struct worker_args* args = (struct worker_args *) arg;
+    lockfree_list_handle* handle = args->operation == lockfree_operation ? lockfree_list_attach(lockfree_ptr) : NULL;
+    unsigned state = args->seed;
+    for (size_t i = 0; i < args->operations; i++) {
+        state = state * 1103515245u + 12345u;
+        args->operation(handle, (int) ((state >> 8) % (unsigned) key_range), (state >> 24) % 100);
+    }
+    if (handle != NULL) {
+        lockfree_list_detach(lockfree_ptr, handle);
+    }
+    return NULL;
+}
+
+static void run(const char* name, SetOperation operation) {
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+        pthread_t ids[64];
+        struct worker_args args[64];
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t i = 0; i < threads; i++) {
+            args[i].operation = operation;
+            args[i].operations = bench_size / threads;
+            args[i].seed = (unsigned) i + 1;
+            pthread_create(&ids[i], NULL, worker, &args[i]);
+        }
+        for (size_t i = 0; i < threads; i++) {
+            pthread_join(ids[i], NULL);
+        }
+        report(name, threads, bench_size / threads * threads, elapsed_ms(&start));
+    }
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_lockfree_list() {
+    lockfree_list_init(lockfree_ptr, sizeof(int), int_comparator);
+    lockfree_list_handle* handle = lockfree_list_attach(lockfree_ptr);
+    for (int key = 0; key < key_range; key += 2) {
+        lockfree_list_insert(lockfree_ptr, handle, &key);
+    }
+    lockfree_list_detach(lockfree_ptr, handle);
+    run("lockfree_list", lockfree_operation);
+    lockfree_list_destroy(lockfree_ptr);
+}
+
+static void bench_mutex_list() {
+    list_init(list_ptr, sizeof(int));
+    for (int key = 0; key < key_range; key += 2) {
+        list_push_back(list_ptr, &key);
+    }
+    run("mutex list", mutex_operation);
+    list_clear(list_ptr);
+}
+
+BenchFunction bench_functions[] = {
+        bench_lockfree_list,
+        bench_mutex_list
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    lockfree_ptr = (lockfree_list *) malloc(sizeof(lockfree_list));
+    list_ptr = (list *) malloc(sizeof(list));
+    for (size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    free(lockfree_ptr);
+    lockfree_ptr = NULL;
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Throughput of the queue operations, build with optimizations:
+ *     cc -O2 -std=gnu11 bench/bench_queue.c src/queue.c src/ring_queue.c -o bench_queue && ./bench_queue [size]
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "../src/queue.h"
+#include "../src/ring_queue.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+
+/* Global Variables */
+queue* queue_ptr;
+size_t bench_size = 1000000;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t operations, double ms) {
+    printf("%-28s %10zu ops %10.2f ms %8.1f Mops/s\n", name, operations, ms, (double) operations / ms / 1e3);
+}
+
+static void fill(queue* queue) {
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        queue_push(queue, &val);
+    }
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_queue_push() {
+    queue_init(queue_ptr, sizeof(long));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    fill(queue_ptr);
+    report("queue_push", bench_size, elapsed_ms(&start));
+    queue_clear(queue_ptr);
+}
+
+static void bench_queue_traverse() {
+    queue_init(queue_ptr, sizeof(long));
+    fill(queue_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long sum = 0;
+    for(int round = 0; round < 10; round++) {
+        for(node* node = queue_ptr->head; node != NULL; node = node->next) {
+            sum += *(long *) node->val;
+        }
+    }
+    report("queue traverse", 10 * bench_size, elapsed_ms(&start));
+    assert(sum == 10 * (long) (bench_size * (bench_size - 1) / 2));
+    queue_clear(queue_ptr);
+}
+
+static void bench_queue_pop() {
+    queue_init(queue_ptr, sizeof(long));
+    fill(queue_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while(!queue_is_empty(queue_ptr)) {
+        queue_pop(queue_ptr);
+    }
+    report("queue_pop", bench_size, elapsed_ms(&start));
+}
+
+static void bench_queue_churn() {
+    queue_init(queue_ptr, sizeof(long));
+    for(long i = 0; i < 1024; i++) {
+        queue_push(queue_ptr, &i);
+    }
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        queue_pop(queue_ptr);
+        queue_push(queue_ptr, &val);
+    }
+    report("queue_pop+push", bench_size, elapsed_ms(&start));
+    queue_clear(queue_ptr);
+}
+
+static void bench_ring_queue_push_pop() {
+    ring_queue ring;
+    ring_queue_init(&ring, sizeof(long));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        ring_queue_push(&ring, &val);
+    }
+    report("ring_queue_push", bench_size, elapsed_ms(&start));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while(!ring_queue_is_empty(&ring)) {
+        ring_queue_pop(&ring);
+    }
+    report("ring_queue_pop", bench_size, elapsed_ms(&start));
+    ring_queue_destroy(&ring);
+}
+
+static void bench_ring_queue_churn() {
+    ring_queue ring;
+    ring_queue_init(&ring, sizeof(long));
+    for(long i = 0; i < 1024; i++) {
+        ring_queue_push(&ring, &i);
+    }
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        ring_queue_pop(&ring);
+        ring_queue_push(&ring, &val);
+    }
+    report("ring_queue_pop+push", bench_size, elapsed_ms(&start));
+    ring_queue_destroy(&ring);
+}
+
+BenchFunction bench_functions[] = {
+        bench_queue_push,
+        bench_queue_traverse,
+        bench_queue_pop,
+        bench_queue_churn,
+        bench_ring_queue_push_pop,
+        bench_ring_queue_churn
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    queue_ptr = (queue *) malloc(sizeof(queue));
+    for(size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    free(queue_ptr);
+    queue_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * Reader throughput from 1 to 64 threads while one writer keeps updating,
+ * the RCU list against a list behind a rwlock, build with optimizations:
+ *     cc -O2 -std=gnu11 -pthread bench/bench_rcu_list.c src/rcu_list.c src/list.c \
+ *         -o bench_rcu_list && ./bench_rcu_list [traversals]
+ * Each traversal sums a list of 256 ints.
+ */
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "../src/rcu_list.h"
+#include "../src/list.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+typedef long (* Traversal) (void* reader);
+
+/* Global Variables */
+rcu_list* rcu_ptr;
+list* list_ptr;
+pthread_rwlock_t list_lock = PTHREAD_RWLOCK_INITIALIZER;
+atomic_bool readers_done;
+size_t bench_size = 200000;
+int elements = 256;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t threads, size_t operations, double ms) {
+    printf("%-20s %3zu readers %10zu traversals %10.2f ms %8.3f Mtraversals/s\n",
+           name, threads, operations, ms, (double) operations / ms / 1e3);
+}
+
+static long rcu_traversal(void* reader) {
+    long sum = 0;
+    rcu_list_read_lock(rcu_ptr, reader);
+    rcu_list_for_each(node, rcu_ptr) {
+        sum += *(int *) node->val;
+    }
+    rcu_list_read_unlock(reader);
+    return sum;
+}
+
+static long rwlock_traversal(void* reader) {
+    long sum = 0;
+    pthread_rwlock_rdlock(&list_lock);
+    list_for_each(node, list_ptr) {
+        sum += *(int *) node->val;
+    }
+    pthread_rwlock_unlock(&list_lock);
+    return sum;
+}
+
+struct reader_args {
+    Traversal traversal;
+    size_t traversals;
+    long sum;
+};
+
+static void* reader_worker(void* arg) {
+    struct reader_args* args = (struct reader_args *) arg;
+    rcu_list_reader* reader = args->traversal == rcu_traversal ? rcu_list_register(rcu_ptr) : NULL;
+    for (size_t i = 0; i < args->traversals; i++) {
+        args->sum += args->traversal(reader);
+    }
+    if (reader != NULL) {
+        rcu_list_unregister(rcu_ptr, reader);
+    }
+    return NULL;
+}
+
+static void* writer_worker(void* arg) {
+    bool rcu = *(bool *) arg;
+    int val = elements;
+    while (!atomic_load(&readers_done)) {
+        if (rcu) {
+            rcu_list_pop_front(rcu_ptr);
+            rcu_list_push_back(rcu_ptr, &val);
+        }
+        else {
+            pthread_rwlock_wrlock(&list_lock);
+            list_pop_front(list_ptr);
+            list_push_back(list_ptr, &val);
+            pthread_rwlock_unlock(&list_lock);
+        }
+        val++;
+        struct timespec pause = {0, 100000};
+        nanosleep(&pause, NULL);
+    }
+    return NULL;
+}
+
+static void run(const char* name, Traversal traversal, bool rcu) {
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+        pthread_t writer;
+        pthread_t ids[64];
+        struct reader_args args[64];
+        atomic_store(&readers_done, false);
+        pthread_create(&writer, NULL, writer_worker, &rcu);
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t i = 0; i < threads; i++) {
+            args[i].traversal = traversal;
+            args[i].traversals = bench_size / threads;
+            args[i].sum = 0;
+            pthread_create(&ids[i], NULL, reader_worker, &args[i]);
+        }
+        for (size_t i = 0; i < threads; i++) {
+            pthread_join(ids[i], NULL);
+        }
+        report(name, threads, bench_size / threads * threads, elapsed_ms(&start));
+        atomic_store(&readers_done, true);
+        pthread_join(writer, NULL);
+    }
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_rcu_list() {
+    rcu_list_init(rcu_ptr, sizeof(int));
+    for (int i = 0; i < elements; i++) {
+        rcu_list_push_back(rcu_ptr, &i);
+    }
+    run("rcu_list", rcu_traversal, true);
+    rcu_list_destroy(rcu_ptr);
+}
+
+static void bench_rwlock_list() {
+    list_init(list_ptr, sizeof(int));
+    for (int i = 0; i < elements; i++) {
+        list_push_back(list_ptr, &i);
+    }
+    run("rwlock list", rwlock_traversal, false);
+    list_clear(list_ptr);
+}
+
+BenchFunction bench_functions[] = {
+        bench_rcu_list,
+        bench_rwlock_list
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    rcu_ptr = (rcu_list *) malloc(sizeof(rcu_list));
+    list_ptr = (list *) malloc(sizeof(list));
+    for (size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    free(rcu_ptr);
+    rcu_ptr = NULL;
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
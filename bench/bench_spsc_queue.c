@@ -0,0 +1,179 @@
+/*
+ * Transfer rate between one producer thread and one consumer thread, the
+ * SPSC queue against a ring queue behind a mutex, build with optimizations:
+ *     cc -O2 -std=gnu11 -pthread bench/bench_spsc_queue.c src/spsc_queue.c src/ring_queue.c \
+ *         -o bench_spsc_queue && ./bench_spsc_queue [items]
+ * The batched runs move up to 256 items per call, a side that finds the
+ * queue full or empty yields.
+ */
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/spsc_queue.h"
+#include "../src/ring_queue.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+typedef size_t (* Transfer) (void* array, size_t count);
+
+/* Global Variables */
+spsc_queue spsc;
+ring_queue ring;
+pthread_mutex_t ring_lock = PTHREAD_MUTEX_INITIALIZER;
+size_t bench_size = 100000000;
+size_t capacity = 4096;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t operations, double ms) {
+    printf("%-20s %12zu items %10.2f ms %8.3f Mitems/s\n", name, operations, ms, (double) operations / ms / 1e3);
+}
+
+static size_t spsc_push(void* array, size_t count) {
+    return count == 1 ? spsc_queue_push(&spsc, array) : spsc_queue_push_n(&spsc, array, count);
+}
+
+static size_t spsc_pop(void* array, size_t count) {
+    return count == 1 ? spsc_queue_pop(&spsc, array) : spsc_queue_pop_n(&spsc, array, count);
+}
+
+static size_t ring_push(void* array, size_t count) {
+    size_t pushed = 0;
+    pthread_mutex_lock(&ring_lock);
+    while (pushed < count && ring_queue_size(&ring) < capacity) {
+        ring_queue_push(&ring, (long *) array + pushed);
+        pushed++;
+    }
+    pthread_mutex_unlock(&ring_lock);
+    return pushed;
+}
+
+static size_t ring_pop(void* array, size_t count) {
+    size_t popped = 0;
+    pthread_mutex_lock(&ring_lock);
+    while (popped < count && !ring_queue_is_empty(&ring)) {
+        ring_queue_front(&ring, (long *) array + popped);
+        ring_queue_pop(&ring);
+        popped++;
+    }
+    pthread_mutex_unlock(&ring_lock);
+    return popped;
+}
+
+struct worker_args {
+    Transfer transfer;
+    size_t batch;
+    long sum;
+};
+
+static void* producer_worker(void* arg) {
+    struct worker_args* args = (struct worker_args *) arg;
+    long batch[256];
+    size_t sent = 0;
+    while (sent < bench_size) {
+        size_t count = bench_size - sent < args->batch ? bench_size - sent : args->batch;
+        for (size_t i = 0; i < count; i++) {
+            batch[i] = (long) (sent + i);
+        }
+        size_t done = 0;
+        while (done < count) {
+            size_t pushed = args->transfer(batch + done, count - done);
+            if (pushed == 0) {
+                sched_yield();
+            }
+            done += pushed;
+        }
+        sent += count;
+    }
+    return NULL;
+}
+
+static void* consumer_worker(void* arg) {
+    struct worker_args* args = (struct worker_args *) arg;
+    long batch[256];
+    size_t received = 0;
+    while (received < bench_size) {
+        size_t count = args->transfer(batch, args->batch);
+        if (count == 0) {
+            sched_yield();
+        }
+        for (size_t i = 0; i < count; i++) {
+            args->sum += batch[i];
+        }
+        received += count;
+    }
+    return NULL;
+}
+
+static void run(const char* name, Transfer push, Transfer pop, size_t batch) {
+    pthread_t producer;
+    pthread_t consumer;
+    struct worker_args producer_args = {push, batch, 0};
+    struct worker_args consumer_args = {pop, batch, 0};
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&producer, NULL, producer_worker, &producer_args);
+    pthread_create(&consumer, NULL, consumer_worker, &consumer_args);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    report(name, bench_size, elapsed_ms(&start));
+    if (consumer_args.sum != (long) (bench_size * (bench_size - 1) / 2)) {
+        printf("%s lost items\n", name);
+    }
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_spsc_queue() {
+    spsc_queue_init(&spsc, sizeof(long), capacity);
+    run("spsc_queue", spsc_push, spsc_pop, 1);
+    spsc_queue_destroy(&spsc);
+}
+
+static void bench_spsc_queue_batch() {
+    spsc_queue_init(&spsc, sizeof(long), capacity);
+    run("spsc_queue batch", spsc_push, spsc_pop, 256);
+    spsc_queue_destroy(&spsc);
+}
+
+static void bench_mutex_ring_queue() {
+    ring_queue_init(&ring, sizeof(long));
+    ring_queue_reserve(&ring, capacity);
+    run("mutex ring_queue", ring_push, ring_pop, 1);
+    ring_queue_destroy(&ring);
+}
+
+static void bench_mutex_ring_queue_batch() {
+    ring_queue_init(&ring, sizeof(long));
+    ring_queue_reserve(&ring, capacity);
+    run("mutex ring batch", ring_push, ring_pop, 256);
+    ring_queue_destroy(&ring);
+}
+
+BenchFunction bench_functions[] = {
+        bench_spsc_queue,
+        bench_spsc_queue_batch,
+        bench_mutex_ring_queue,
+        bench_mutex_ring_queue_batch
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    for (size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Throughput of the stack operations, build with optimizations:
+ *     cc -O2 -std=gnu11 bench/bench_stack.c src/stack.c -o bench_stack && ./bench_stack [size]
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "../src/stack.h"
+
+/* Pointer Functions */
+typedef void (* BenchFunction) ();
+
+/* Global Variables */
+stack* stack_ptr;
+size_t bench_size = 1000000;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static double elapsed_ms(const struct timespec* start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start->tv_sec) * 1e3 + (double) (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char* name, size_t operations, double ms) {
+    printf("%-28s %10zu ops %10.2f ms %8.1f Mops/s\n", name, operations, ms, (double) operations / ms / 1e3);
+}
+
+static void fill(stack* stack) {
+    for(size_t i = 0; i < bench_size; i++) {
+        long val = (long) i;
+        stack_push(stack, &val);
+    }
+}
+
+
+/** B E N C H M A R K   F U N C T I O N S **/
+
+static void bench_stack_push() {
+    stack_init(stack_ptr, sizeof(long));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    fill(stack_ptr);
+    report("stack_push", bench_size, elapsed_ms(&start));
+    stack_clear(stack_ptr);
+}
+
+static void bench_stack_traverse() {
+    stack_init(stack_ptr, sizeof(long));
+    fill(stack_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long sum = 0;
+    for(int round = 0; round < 10; round++) {
+        for(node* node = stack_ptr->top; node != NULL; node = node->prev) {
+            sum += *(long *) node->val;
+        }
+    }
+    report("stack traverse", 10 * bench_size, elapsed_ms(&start));
+    assert(sum == 10 * (long) (bench_size * (bench_size - 1) / 2));
+    stack_clear(stack_ptr);
+}
+
+static void bench_stack_pop() {
+    stack_init(stack_ptr, sizeof(long));
+    fill(stack_ptr);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while(!stack_is_empty(stack_ptr)) {
+        stack_pop(stack_ptr);
+    }
+    report("stack_pop", bench_size, elapsed_ms(&start));
+}
+
+BenchFunction bench_functions[] = {
+        bench_stack_push,
+        bench_stack_traverse,
+        bench_stack_pop
+};
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        bench_size = strtoul(argv[1], NULL, 10);
+    }
+    size_t benches_size = sizeof(bench_functions) / sizeof(BenchFunction);
+    stack_ptr = (stack *) malloc(sizeof(stack));
+    for(size_t i = 0; i < benches_size; i++) {
+        bench_functions[i]();
+    }
+    free(stack_ptr);
+    stack_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include "bloom_filter.h"
+
+/* The odd multipliers picking the bit of each block word, one per word. */
+static const uint32_t bloom_filter_salts[BLOOM_FILTER_BLOCK_WORDS] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
+/**
+ * @brief Finds the block of the specified hash, the high half of the hash picks the block.
+ *
+ * @param filter The filter holding the blocks.
+ * @param hash The hash of the element.
+ *
+ * @return A pointer to the first word of the block.
+ */
+static uint32_t* bloom_filter_block(const bloom_filter* filter, uint64_t hash) {
+    size_t block = (size_t) (((hash >> 32) * filter->block_count) >> 32);
+    return filter->blocks + block * BLOOM_FILTER_BLOCK_WORDS;
+}
+
+/**
+ * @brief Initialize the Bloom filter sized for the expected number of elements.
+ *
+ * @param filter The filter to be initialized.
+ * @param element_size The size of each element.
+ * @param expected_size The number of elements the filter is sized for.
+ * @param bits_per_element The number of bits per expected element, BLOOM_FILTER_BITS_PER_ELEMENT gives about 0.5% false positives.
+ */
+void bloom_filter_init(bloom_filter* filter, size_t element_size, size_t expected_size, size_t bits_per_element) {
+    assert(filter != NULL && element_size > 0 && bits_per_element > 0);
+
+    size_t block_bits = BLOOM_FILTER_BLOCK_WORDS * 32;
+    size_t block_count = (expected_size * bits_per_element + block_bits - 1) / block_bits;
+    filter->block_count = block_count > 0 ? block_count : 1;
+    filter->blocks = (uint32_t *) aligned_alloc(sizeof(uint32_t) * BLOOM_FILTER_BLOCK_WORDS,
+                                                sizeof(uint32_t) * BLOOM_FILTER_BLOCK_WORDS * filter->block_count);
+    memset(filter->blocks, 0, sizeof(uint32_t) * BLOOM_FILTER_BLOCK_WORDS * filter->block_count);
+    filter->size = 0;
+    filter->element_size = element_size;
+}
+
+/**
+ * @brief Initialize the Bloom filter with all the elements of the specified vector.
+ *        Insert every element pushed to the vector afterwards to keep it in sync.
+ *
+ * @param filter The filter to be initialized.
+ * @param vector The vector whose elements will be added.
+ * @param bits_per_element The number of bits per element of the vector.
+ */
+void bloom_filter_from_vector(bloom_filter* filter, const vector* vector, size_t bits_per_element) {
+    assert(filter != NULL && vector != NULL && vector->data != NULL);
+
+    bloom_filter_init(filter, vector->element_size, vector->size, bits_per_element);
+    bloom_filter_insert_array(filter, vector->data, vector->size);
+}
+
+/**
+ * @brief Checks whether or not the specified value may be in the filter.
+ *
+ * @param filter The filter to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return False if the value was never inserted, true if it probably was.
+ */
+bool bloom_filter_may_contain(const bloom_filter* filter, const void* val) {
+    assert(filter != NULL && filter->blocks != NULL && val != NULL);
+
+    uint64_t hash = hash_bytes(val, filter->element_size, 0);
+    const uint32_t* block = bloom_filter_block(filter, hash);
+    uint32_t key = (uint32_t) hash;
+    uint32_t missing = 0;
+    for (size_t i = 0; i < BLOOM_FILTER_BLOCK_WORDS; i++) {
+        missing |= ~block[i] & (1U << ((key * bloom_filter_salts[i]) >> 27));
+    }
+    return missing == 0;
+}
+
+/**
+ * @brief Retrieves the index of the specified value in the vector or -1 if it's not found,
+ *        the vector is only scanned when the filter may contain the value.
+ *
+ * @param filter The filter kept in sync with the vector.
+ * @param vector The vector to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int bloom_filter_vector_index_of(const bloom_filter* filter, const vector* vector, void* val) {
+    assert(filter != NULL && vector != NULL && filter->element_size == vector->element_size);
+
+    if (!bloom_filter_may_contain(filter, val)) {
+        return -1;
+    }
+    return vector_index_of(vector, val);
+}
+
+/**
+ * @brief Inserts the specified value into the filter.
+ *
+ * @param filter The filter to insert into.
+ * @param val The value to be inserted.
+ */
+void bloom_filter_insert(bloom_filter* filter, const void* val) {
+    assert(filter != NULL && filter->blocks != NULL && val != NULL);
+
+    uint64_t hash = hash_bytes(val, filter->element_size, 0);
+    uint32_t* block = bloom_filter_block(filter, hash);
+    uint32_t key = (uint32_t) hash;
+    for (size_t i = 0; i < BLOOM_FILTER_BLOCK_WORDS; i++) {
+        block[i] |= 1U << ((key * bloom_filter_salts[i]) >> 27);
+    }
+    filter->size++;
+}
+
+/**
+ * @brief Inserts all the elements of the specified array into the filter.
+ *
+ * @param filter The filter to insert into.
+ * @param array The array whose elements will be inserted.
+ * @param array_size The number of elements in the array.
+ */
+void bloom_filter_insert_array(bloom_filter* filter, const void* array, size_t array_size) {
+    assert(filter != NULL && (array != NULL || array_size == 0));
+
+    const byte* elements = (const byte *) array;
+    for (size_t i = 0; i < array_size; i++) {
+        bloom_filter_insert(filter, elements + i * filter->element_size);
+    }
+}
+
+/**
+ * @brief Removes all the elements from the filter.
+ *
+ * @param filter A pointer to the filter to remove from.
+ */
+void bloom_filter_clear(bloom_filter* filter) {
+    assert(filter != NULL && filter->blocks != NULL);
+
+    memset(filter->blocks, 0, sizeof(uint32_t) * BLOOM_FILTER_BLOCK_WORDS * filter->block_count);
+    filter->size = 0;
+}
+
+/**
+ * @brief Frees the memory allocated for the filter.
+ *
+ * @param filter A pointer to the filter to free from.
+ */
+void bloom_filter_destroy(bloom_filter* filter) {
+    assert(filter != NULL);
+
+    free(filter->blocks);
+    filter->blocks = NULL;
+    filter->block_count = 0;
+    filter->size = 0;
+}
+
+/**
+ * @brief Gets the number of insertions into the filter.
+ *
+ * @param filter The filter whose size will be returned.
+ *
+ * @return The number of inserted elements.
+ */
+size_t bloom_filter_size(const bloom_filter* filter) {
+    assert(filter != NULL);
+
+    return filter->size;
+}
+
+/**
+ * @brief Gets the number of bytes used by the filter bits.
+ *
+ * @param filter The filter whose memory size will be returned.
+ *
+ * @return The number of bytes of the blocks.
+ */
+size_t bloom_filter_memory_size(const bloom_filter* filter) {
+    assert(filter != NULL);
+
+    return sizeof(uint32_t) * BLOOM_FILTER_BLOCK_WORDS * filter->block_count;
+}
+
+/**
+ * @brief Measures the false positive rate of the filter over values known not to be inserted.
+ *
+ * @param filter The filter to be measured.
+ * @param absent The array of values which were never inserted.
+ * @param absent_size The number of values in the array.
+ *
+ * @return The fraction of the values the filter reports as maybe present.
+ */
+double bloom_filter_false_positive_rate(const bloom_filter* filter, const void* absent, size_t absent_size) {
+    assert(filter != NULL && absent != NULL && absent_size > 0);
+
+    const byte* elements = (const byte *) absent;
+    size_t positives = 0;
+    for (size_t i = 0; i < absent_size; i++) {
+        positives += bloom_filter_may_contain(filter, elements + i * filter->element_size);
+    }
+    return (double) positives / (double) absent_size;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file     bloom_filter.h
+ *
+ * @brief    The Implementation of the Blocked Bloom Filter.
+ * @author   Hassan Tarek
+ */
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "hash.h"
+#include "vector.h"
+
+/* Struct type declaration */
+struct bloom_filter;
+
+/* Typedefs */
+typedef struct bloom_filter bloom_filter;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the blocked Bloom filter.
+ *
+ * Each element sets one bit in every word of a single 256-bit block, so a
+ * lookup reads one 32-byte block and its eight word probes are independent
+ * and vectorized by the compiler. A negative answer is exact, a positive one
+ * may be false. Elements cannot be removed, a removal from the container
+ * only leaves a stale positive behind.
+ */
+struct bloom_filter {
+    uint32_t* blocks;
+    size_t block_count;
+    size_t size;
+    size_t element_size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void bloom_filter_init(bloom_filter* filter, size_t element_size, size_t expected_size, size_t bits_per_element);
+void bloom_filter_from_vector(bloom_filter* filter, const vector* vector, size_t bits_per_element);
+
+/* Searching */
+bool bloom_filter_may_contain(const bloom_filter* filter, const void* val);
+int bloom_filter_vector_index_of(const bloom_filter* filter, const vector* vector, void* val);
+
+/* Insertion */
+void bloom_filter_insert(bloom_filter* filter, const void* val);
+void bloom_filter_insert_array(bloom_filter* filter, const void* array, size_t array_size);
+
+/* Removal */
+void bloom_filter_clear(bloom_filter* filter);
+void bloom_filter_destroy(bloom_filter* filter);
+
+/* Utility */
+size_t bloom_filter_size(const bloom_filter* filter);
+size_t bloom_filter_memory_size(const bloom_filter* filter);
+double bloom_filter_false_positive_rate(const bloom_filter* filter, const void* absent, size_t absent_size);
+
+
+/* M A C R O S */
+
+#define BLOOM_FILTER_BLOCK_WORDS 8
+#define BLOOM_FILTER_BITS_PER_ELEMENT 12
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BLOOM_FILTER_H */
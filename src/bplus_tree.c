@@ -0,0 +1,701 @@
+#include "bplus_tree.h"
+
+/**
+ * @brief Rounds the specified size up to the alignment of any value type.
+ *
+ * @param size The size to be rounded.
+ *
+ * @return The rounded size.
+ */
+static size_t bplus_tree_align(size_t size) {
+    size_t alignment = _Alignof(max_align_t);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Gets the key at the specified position of a leaf.
+ */
+static byte* bplus_tree_leaf_key(const bplus_tree* tree, const bplus_tree_node* node, size_t index) {
+    return (byte *) node->data + index * tree->key_size;
+}
+
+/**
+ * @brief Gets the value at the specified position of a leaf, the values follow the keys.
+ */
+static byte* bplus_tree_leaf_value(const bplus_tree* tree, const bplus_tree_node* node, size_t index) {
+    return (byte *) node->data + tree->values_offset + index * tree->value_size;
+}
+
+/**
+ * @brief Gets the children array of an inner node.
+ */
+static bplus_tree_node** bplus_tree_children(const bplus_tree_node* node) {
+    return (bplus_tree_node **) node->data;
+}
+
+/**
+ * @brief Gets the separator key at the specified position of an inner node, the keys follow the children.
+ */
+static byte* bplus_tree_inner_key(const bplus_tree* tree, const bplus_tree_node* node, size_t index) {
+    return (byte *) node->data + tree->keys_offset + index * tree->key_size;
+}
+
+/**
+ * @brief Allocates an empty node of the specified kind.
+ *
+ * @param tree The tree the node belongs to.
+ * @param is_leaf Whether or not the node is a leaf.
+ *
+ * @return A pointer to the new node.
+ */
+static bplus_tree_node* bplus_tree_create_node(const bplus_tree* tree, bool is_leaf) {
+    size_t data_size = is_leaf ? tree->values_offset + tree->leaf_capacity * tree->value_size
+                               : tree->keys_offset + (tree->inner_capacity - 1) * tree->key_size;
+    bplus_tree_node* node = (bplus_tree_node *) malloc(sizeof(bplus_tree_node) + data_size);
+    node->count = 0;
+    node->next = NULL;
+    node->is_leaf = is_leaf;
+    return node;
+}
+
+/**
+ * @brief Frees the specified node and all the nodes under it.
+ *
+ * @param node The root of the subtree to be freed.
+ */
+static void bplus_tree_free_nodes(bplus_tree_node* node) {
+    if (!node->is_leaf) {
+        bplus_tree_node** children = bplus_tree_children(node);
+        for (size_t i = 0; i < node->count; i++) {
+            bplus_tree_free_nodes(children[i]);
+        }
+    }
+    free(node);
+}
+
+/**
+ * @brief Finds the position of the first key of the leaf which is not less than the specified key.
+ *
+ * @param tree The tree holding the leaf.
+ * @param node The leaf to be scanned.
+ * @param key The key to be searched for.
+ *
+ * @return The position of the lower bound in the leaf.
+ */
+static size_t bplus_tree_leaf_search(const bplus_tree* tree, const bplus_tree_node* node, const void* key) {
+    size_t index = 0;
+    while (index < node->count && tree->compare(bplus_tree_leaf_key(tree, node, index), key) < 0) {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @brief Finds the child of the inner node whose subtree may hold the specified key.
+ *
+ * @param tree The tree holding the node.
+ * @param node The inner node to be scanned.
+ * @param key The key to be searched for.
+ *
+ * @return The position of the child.
+ */
+static size_t bplus_tree_inner_search(const bplus_tree* tree, const bplus_tree_node* node, const void* key) {
+    size_t index = 0;
+    while (index + 1 < node->count && tree->compare(bplus_tree_inner_key(tree, node, index), key) <= 0) {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @brief Finds the leaf which may hold the specified key.
+ *
+ * @param tree The tree to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return The leaf which may hold the key.
+ */
+static bplus_tree_node* bplus_tree_find_leaf(const bplus_tree* tree, const void* key) {
+    bplus_tree_node* node = tree->root;
+    while (!node->is_leaf) {
+        node = bplus_tree_children(node)[bplus_tree_inner_search(tree, node, key)];
+    }
+    return node;
+}
+
+/**
+ * @brief Inserts the key value pair into the subtree rooted at the specified node.
+ *        An overflowing node is split in halves and the smallest key of the
+ *        right half is stored in the tree split key.
+ *
+ * @param tree The tree to insert into.
+ * @param node The root of the subtree.
+ * @param key The key to be inserted.
+ * @param value The value to be inserted.
+ * @param inserted Receives whether the key is new or its value was replaced.
+ *
+ * @return The new right sibling of the node if it was split, NULL otherwise.
+ */
+static bplus_tree_node* bplus_tree_insert_into(bplus_tree* tree, bplus_tree_node* node, const void* key,
+                                               const void* value, bool* inserted) {
+    size_t key_size = tree->key_size;
+    size_t value_size = tree->value_size;
+    if (node->is_leaf) {
+        size_t index = bplus_tree_leaf_search(tree, node, key);
+        if (index < node->count && tree->compare(bplus_tree_leaf_key(tree, node, index), key) == 0) {
+            memcpy(bplus_tree_leaf_value(tree, node, index), value, sizeof(byte) * value_size);
+            *inserted = false;
+            return NULL;
+        }
+        size_t moved = node->count - index;
+        memmove(bplus_tree_leaf_key(tree, node, index + 1), bplus_tree_leaf_key(tree, node, index),
+                sizeof(byte) * moved * key_size);
+        memmove(bplus_tree_leaf_value(tree, node, index + 1), bplus_tree_leaf_value(tree, node, index),
+                sizeof(byte) * moved * value_size);
+        memcpy(bplus_tree_leaf_key(tree, node, index), key, sizeof(byte) * key_size);
+        memcpy(bplus_tree_leaf_value(tree, node, index), value, sizeof(byte) * value_size);
+        node->count++;
+        *inserted = true;
+        if (node->count < tree->leaf_capacity) {
+            return NULL;
+        }
+
+        bplus_tree_node* right = bplus_tree_create_node(tree, true);
+        size_t left_count = node->count / 2;
+        right->count = node->count - left_count;
+        memcpy(bplus_tree_leaf_key(tree, right, 0), bplus_tree_leaf_key(tree, node, left_count),
+               sizeof(byte) * right->count * key_size);
+        memcpy(bplus_tree_leaf_value(tree, right, 0), bplus_tree_leaf_value(tree, node, left_count),
+               sizeof(byte) * right->count * value_size);
+        node->count = left_count;
+        right->next = node->next;
+        node->next = right;
+        memcpy(tree->split_key, bplus_tree_leaf_key(tree, right, 0), sizeof(byte) * key_size);
+        return right;
+    }
+
+    size_t index = bplus_tree_inner_search(tree, node, key);
+    bplus_tree_node** children = bplus_tree_children(node);
+    bplus_tree_node* new_child = bplus_tree_insert_into(tree, children[index], key, value, inserted);
+    if (new_child == NULL) {
+        return NULL;
+    }
+    size_t moved = node->count - 1 - index;
+    memmove(bplus_tree_inner_key(tree, node, index + 1), bplus_tree_inner_key(tree, node, index),
+            sizeof(byte) * moved * key_size);
+    memmove(children + index + 2, children + index + 1, sizeof(bplus_tree_node*) * moved);
+    memcpy(bplus_tree_inner_key(tree, node, index), tree->split_key, sizeof(byte) * key_size);
+    children[index + 1] = new_child;
+    node->count++;
+    if (node->count < tree->inner_capacity) {
+        return NULL;
+    }
+
+    bplus_tree_node* right = bplus_tree_create_node(tree, false);
+    size_t left_count = node->count / 2;
+    right->count = node->count - left_count;
+    memcpy(bplus_tree_children(right), children + left_count, sizeof(bplus_tree_node*) * right->count);
+    memcpy(bplus_tree_inner_key(tree, right, 0), bplus_tree_inner_key(tree, node, left_count),
+           sizeof(byte) * (right->count - 1) * key_size);
+    memcpy(tree->split_key, bplus_tree_inner_key(tree, node, left_count - 1), sizeof(byte) * key_size);
+    node->count = left_count;
+    return right;
+}
+
+/**
+ * @brief Removes the separator key at the specified position and the child to its right.
+ *
+ * @param tree The tree holding the node.
+ * @param node The inner node to remove from.
+ * @param index The position of the separator key.
+ */
+static void bplus_tree_remove_separator(bplus_tree* tree, bplus_tree_node* node, size_t index) {
+    size_t moved = node->count - 2 - index;
+    memmove(bplus_tree_inner_key(tree, node, index), bplus_tree_inner_key(tree, node, index + 1),
+            sizeof(byte) * moved * tree->key_size);
+    bplus_tree_node** children = bplus_tree_children(node);
+    memmove(children + index + 1, children + index + 2, sizeof(bplus_tree_node*) * moved);
+    node->count--;
+}
+
+/**
+ * @brief Restores the minimum fill of the child at the specified position by
+ *        merging it with a sibling or borrowing one entry from it.
+ *
+ * @param tree The tree holding the node.
+ * @param parent The inner node holding the child.
+ * @param index The position of the underfull child.
+ */
+static void bplus_tree_rebalance(bplus_tree* tree, bplus_tree_node* parent, size_t index) {
+    size_t key_size = tree->key_size;
+    size_t value_size = tree->value_size;
+    size_t separator = index > 0 ? index - 1 : index;
+    bplus_tree_node* left = bplus_tree_children(parent)[separator];
+    bplus_tree_node* right = bplus_tree_children(parent)[separator + 1];
+    byte* parent_key = bplus_tree_inner_key(tree, parent, separator);
+
+    if (left->is_leaf) {
+        if (left->count + right->count < tree->leaf_capacity) {
+            memcpy(bplus_tree_leaf_key(tree, left, left->count), bplus_tree_leaf_key(tree, right, 0),
+                   sizeof(byte) * right->count * key_size);
+            memcpy(bplus_tree_leaf_value(tree, left, left->count), bplus_tree_leaf_value(tree, right, 0),
+                   sizeof(byte) * right->count * value_size);
+            left->count += right->count;
+            left->next = right->next;
+            free(right);
+            bplus_tree_remove_separator(tree, parent, separator);
+        } else if (left->count > right->count) {
+            memmove(bplus_tree_leaf_key(tree, right, 1), bplus_tree_leaf_key(tree, right, 0),
+                    sizeof(byte) * right->count * key_size);
+            memmove(bplus_tree_leaf_value(tree, right, 1), bplus_tree_leaf_value(tree, right, 0),
+                    sizeof(byte) * right->count * value_size);
+            left->count--;
+            memcpy(bplus_tree_leaf_key(tree, right, 0), bplus_tree_leaf_key(tree, left, left->count),
+                   sizeof(byte) * key_size);
+            memcpy(bplus_tree_leaf_value(tree, right, 0), bplus_tree_leaf_value(tree, left, left->count),
+                   sizeof(byte) * value_size);
+            right->count++;
+            memcpy(parent_key, bplus_tree_leaf_key(tree, right, 0), sizeof(byte) * key_size);
+        } else {
+            memcpy(bplus_tree_leaf_key(tree, left, left->count), bplus_tree_leaf_key(tree, right, 0),
+                   sizeof(byte) * key_size);
+            memcpy(bplus_tree_leaf_value(tree, left, left->count), bplus_tree_leaf_value(tree, right, 0),
+                   sizeof(byte) * value_size);
+            left->count++;
+            right->count--;
+            memmove(bplus_tree_leaf_key(tree, right, 0), bplus_tree_leaf_key(tree, right, 1),
+                    sizeof(byte) * right->count * key_size);
+            memmove(bplus_tree_leaf_value(tree, right, 0), bplus_tree_leaf_value(tree, right, 1),
+                    sizeof(byte) * right->count * value_size);
+            memcpy(parent_key, bplus_tree_leaf_key(tree, right, 0), sizeof(byte) * key_size);
+        }
+        return;
+    }
+
+    bplus_tree_node** left_children = bplus_tree_children(left);
+    bplus_tree_node** right_children = bplus_tree_children(right);
+    if (left->count + right->count < tree->inner_capacity) {
+        memcpy(bplus_tree_inner_key(tree, left, left->count - 1), parent_key, sizeof(byte) * key_size);
+        memcpy(bplus_tree_inner_key(tree, left, left->count), bplus_tree_inner_key(tree, right, 0),
+               sizeof(byte) * (right->count - 1) * key_size);
+        memcpy(left_children + left->count, right_children, sizeof(bplus_tree_node*) * right->count);
+        left->count += right->count;
+        free(right);
+        bplus_tree_remove_separator(tree, parent, separator);
+    } else if (left->count > right->count) {
+        memmove(bplus_tree_inner_key(tree, right, 1), bplus_tree_inner_key(tree, right, 0),
+                sizeof(byte) * (right->count - 1) * key_size);
+        memmove(right_children + 1, right_children, sizeof(bplus_tree_node*) * right->count);
+        memcpy(bplus_tree_inner_key(tree, right, 0), parent_key, sizeof(byte) * key_size);
+        right_children[0] = left_children[left->count - 1];
+        right->count++;
+        memcpy(parent_key, bplus_tree_inner_key(tree, left, left->count - 2), sizeof(byte) * key_size);
+        left->count--;
+    } else {
+        memcpy(bplus_tree_inner_key(tree, left, left->count - 1), parent_key, sizeof(byte) * key_size);
+        left_children[left->count] = right_children[0];
+        left->count++;
+        memcpy(parent_key, bplus_tree_inner_key(tree, right, 0), sizeof(byte) * key_size);
+        memmove(bplus_tree_inner_key(tree, right, 0), bplus_tree_inner_key(tree, right, 1),
+                sizeof(byte) * (right->count - 2) * key_size);
+        memmove(right_children, right_children + 1, sizeof(bplus_tree_node*) * (right->count - 1));
+        right->count--;
+    }
+}
+
+/**
+ * @brief Removes the specified key from the subtree rooted at the specified node.
+ *
+ * @param tree The tree to remove from.
+ * @param node The root of the subtree.
+ * @param key The key to be removed.
+ *
+ * @return Whether or not the key was found and removed.
+ */
+static bool bplus_tree_remove_from(bplus_tree* tree, bplus_tree_node* node, const void* key) {
+    if (node->is_leaf) {
+        size_t index = bplus_tree_leaf_search(tree, node, key);
+        if (index == node->count || tree->compare(bplus_tree_leaf_key(tree, node, index), key) != 0) {
+            return false;
+        }
+        size_t moved = node->count - 1 - index;
+        memmove(bplus_tree_leaf_key(tree, node, index), bplus_tree_leaf_key(tree, node, index + 1),
+                sizeof(byte) * moved * tree->key_size);
+        memmove(bplus_tree_leaf_value(tree, node, index), bplus_tree_leaf_value(tree, node, index + 1),
+                sizeof(byte) * moved * tree->value_size);
+        node->count--;
+        return true;
+    }
+
+    size_t index = bplus_tree_inner_search(tree, node, key);
+    bplus_tree_node* child = bplus_tree_children(node)[index];
+    if (!bplus_tree_remove_from(tree, child, key)) {
+        return false;
+    }
+    size_t min_count = ((child->is_leaf ? tree->leaf_capacity : tree->inner_capacity) - 1) / 2;
+    if (child->count < min_count) {
+        bplus_tree_rebalance(tree, node, index);
+    }
+    return true;
+}
+
+/**
+ * @brief Initialize the B+tree.
+ *
+ * @param tree The tree to be initialized.
+ * @param key_size The size of each key.
+ * @param value_size The size of each value.
+ * @param compare The compare function used to order the keys, as for vector_sort.
+ */
+void bplus_tree_init(bplus_tree* tree, size_t key_size, size_t value_size,
+                     int (* compare)(const void* lhs, const void* rhs)) {
+    assert(tree != NULL && key_size > 0 && compare != NULL);
+
+    size_t header = sizeof(bplus_tree_node);
+    size_t available = BPLUS_TREE_NODE_SIZE > header ? BPLUS_TREE_NODE_SIZE - header : 0;
+
+    size_t leaf_capacity = available / (key_size + value_size);
+    while (leaf_capacity > BPLUS_TREE_MIN_CAPACITY &&
+           bplus_tree_align(leaf_capacity * key_size) + leaf_capacity * value_size > available) {
+        leaf_capacity--;
+    }
+    size_t inner_capacity = (available + key_size) / (sizeof(bplus_tree_node*) + key_size);
+    while (inner_capacity > BPLUS_TREE_MIN_CAPACITY &&
+           bplus_tree_align(inner_capacity * sizeof(bplus_tree_node*)) + (inner_capacity - 1) * key_size > available) {
+        inner_capacity--;
+    }
+
+    tree->key_size = key_size;
+    tree->value_size = value_size;
+    tree->leaf_capacity = leaf_capacity > BPLUS_TREE_MIN_CAPACITY ? leaf_capacity : BPLUS_TREE_MIN_CAPACITY;
+    tree->inner_capacity = inner_capacity > BPLUS_TREE_MIN_CAPACITY ? inner_capacity : BPLUS_TREE_MIN_CAPACITY;
+    tree->values_offset = bplus_tree_align(tree->leaf_capacity * key_size);
+    tree->keys_offset = bplus_tree_align(tree->inner_capacity * sizeof(bplus_tree_node*));
+    tree->compare = compare;
+    tree->split_key = (byte *) malloc(sizeof(byte) * key_size);
+    tree->root = bplus_tree_create_node(tree, true);
+    tree->first = tree->root;
+    tree->size = 0;
+    tree->height = 1;
+}
+
+/**
+ * @brief Builds the tree bottom up from sorted keys and their values, the
+ *        nodes are filled evenly instead of being split one insert at a time.
+ *
+ * @param tree The empty tree to be loaded.
+ * @param keys The keys in strictly increasing order under the compare function.
+ * @param values The values of the keys, in the same order.
+ */
+void bplus_tree_bulk_load(bplus_tree* tree, const vector* keys, const vector* values) {
+    assert(tree != NULL && tree->size == 0 && keys != NULL && values != NULL);
+    assert(keys->element_size == tree->key_size && values->element_size == tree->value_size);
+    assert(keys->size == values->size);
+
+    size_t size = keys->size;
+    if (size == 0) {
+        return;
+    }
+    size_t key_size = tree->key_size;
+    size_t value_size = tree->value_size;
+    for (size_t i = 1; i < size; i++) {
+        assert(tree->compare(keys->data + (i - 1) * key_size, keys->data + i * key_size) < 0);
+    }
+
+    size_t max_count = tree->leaf_capacity - 1;
+    size_t level_size = (size + max_count - 1) / max_count;
+    bplus_tree_node** level = (bplus_tree_node **) malloc(sizeof(bplus_tree_node*) * level_size);
+    const byte** min_keys = (const byte **) malloc(sizeof(byte*) * level_size);
+
+    size_t offset = 0;
+    for (size_t i = 0; i < level_size; i++) {
+        bplus_tree_node* leaf = bplus_tree_create_node(tree, true);
+        leaf->count = size / level_size + (i < size % level_size);
+        memcpy(bplus_tree_leaf_key(tree, leaf, 0), keys->data + offset * key_size,
+               sizeof(byte) * leaf->count * key_size);
+        memcpy(bplus_tree_leaf_value(tree, leaf, 0), values->data + offset * value_size,
+               sizeof(byte) * leaf->count * value_size);
+        offset += leaf->count;
+        if (i > 0) {
+            level[i - 1]->next = leaf;
+        }
+        level[i] = leaf;
+        min_keys[i] = bplus_tree_leaf_key(tree, leaf, 0);
+    }
+
+    free(tree->root);
+    tree->first = level[0];
+    tree->height = 1;
+    max_count = tree->inner_capacity - 1;
+    while (level_size > 1) {
+        size_t parents_size = (level_size + max_count - 1) / max_count;
+        size_t child = 0;
+        for (size_t i = 0; i < parents_size; i++) {
+            bplus_tree_node* parent = bplus_tree_create_node(tree, false);
+            parent->count = level_size / parents_size + (i < level_size % parents_size);
+            memcpy(bplus_tree_children(parent), level + child, sizeof(bplus_tree_node*) * parent->count);
+            for (size_t j = 1; j < parent->count; j++) {
+                memcpy(bplus_tree_inner_key(tree, parent, j - 1), min_keys[child + j], sizeof(byte) * key_size);
+            }
+            min_keys[i] = min_keys[child];
+            level[i] = parent;
+            child += parent->count;
+        }
+        level_size = parents_size;
+        tree->height++;
+    }
+    tree->root = level[0];
+    tree->size = size;
+    free(level);
+    free(min_keys);
+}
+
+/**
+ * @brief Finds the value of the specified key.
+ *        The pointer is valid until the tree is modified.
+ *
+ * @param tree The tree to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return A pointer to the value of the key or NULL if it's not found.
+ */
+void* bplus_tree_find(const bplus_tree* tree, const void* key) {
+    assert(tree != NULL && tree->root != NULL && key != NULL);
+
+    bplus_tree_node* leaf = bplus_tree_find_leaf(tree, key);
+    size_t index = bplus_tree_leaf_search(tree, leaf, key);
+    if (index < leaf->count && tree->compare(bplus_tree_leaf_key(tree, leaf, index), key) == 0) {
+        return bplus_tree_leaf_value(tree, leaf, index);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Checks whether or not the specified key is in the tree.
+ *
+ * @param tree The tree to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return Whether or not the key exists.
+ */
+bool bplus_tree_contains(const bplus_tree* tree, const void* key) {
+    assert(tree != NULL && key != NULL);
+
+    return bplus_tree_find(tree, key) != NULL;
+}
+
+/**
+ * @brief Gets an iterator to the smallest key of the tree.
+ *
+ * @param tree The tree to be iterated.
+ *
+ * @return The iterator, which is not valid if the tree is empty.
+ */
+bplus_tree_iterator bplus_tree_begin(const bplus_tree* tree) {
+    assert(tree != NULL && tree->first != NULL);
+
+    bplus_tree_iterator iterator = {tree, tree->first->count > 0 ? tree->first : NULL, 0};
+    return iterator;
+}
+
+/**
+ * @brief Gets an iterator to the first key which is not less than the specified key,
+ *        the range scan then follows the leaf links.
+ *
+ * @param tree The tree to be iterated.
+ * @param key The key to be searched for.
+ *
+ * @return The iterator, which is not valid if all the keys are smaller.
+ */
+bplus_tree_iterator bplus_tree_lower_bound(const bplus_tree* tree, const void* key) {
+    assert(tree != NULL && tree->root != NULL && key != NULL);
+
+    bplus_tree_node* leaf = bplus_tree_find_leaf(tree, key);
+    size_t index = bplus_tree_leaf_search(tree, leaf, key);
+    if (index == leaf->count) {
+        leaf = leaf->next;
+        index = 0;
+    }
+    bplus_tree_iterator iterator = {tree, leaf, index};
+    return iterator;
+}
+
+/**
+ * @brief Checks whether or not the iterator points to an entry.
+ *
+ * @param iterator The iterator to be checked.
+ *
+ * @return Whether or not the iterator points to an entry.
+ */
+bool bplus_tree_iterator_is_valid(const bplus_tree_iterator* iterator) {
+    assert(iterator != NULL);
+
+    return iterator->leaf != NULL;
+}
+
+/**
+ * @brief Advances the iterator to the next key in order.
+ *
+ * @param iterator The valid iterator to be advanced.
+ */
+void bplus_tree_iterator_next(bplus_tree_iterator* iterator) {
+    assert(iterator != NULL && iterator->leaf != NULL);
+
+    iterator->index++;
+    if (iterator->index == iterator->leaf->count) {
+        iterator->leaf = iterator->leaf->next;
+        iterator->index = 0;
+    }
+}
+
+/**
+ * @brief Gets the key the iterator points to.
+ *
+ * @param iterator The valid iterator.
+ *
+ * @return A pointer to the key.
+ */
+const void* bplus_tree_iterator_key(const bplus_tree_iterator* iterator) {
+    assert(iterator != NULL && iterator->leaf != NULL);
+
+    return bplus_tree_leaf_key(iterator->tree, iterator->leaf, iterator->index);
+}
+
+/**
+ * @brief Gets the value the iterator points to, which may be modified in place.
+ *
+ * @param iterator The valid iterator.
+ *
+ * @return A pointer to the value.
+ */
+void* bplus_tree_iterator_value(const bplus_tree_iterator* iterator) {
+    assert(iterator != NULL && iterator->leaf != NULL);
+
+    return bplus_tree_leaf_value(iterator->tree, iterator->leaf, iterator->index);
+}
+
+/**
+ * @brief Inserts a copy of the key value pair, replacing the value if the key exists.
+ *
+ * @param tree The tree to insert into.
+ * @param key The key to be inserted.
+ * @param value The value to be inserted.
+ *
+ * @return Whether or not the key is new.
+ */
+bool bplus_tree_insert(bplus_tree* tree, const void* key, const void* value) {
+    assert(tree != NULL && tree->root != NULL && key != NULL && (value != NULL || tree->value_size == 0));
+
+    bool inserted;
+    bplus_tree_node* right = bplus_tree_insert_into(tree, tree->root, key, value, &inserted);
+    if (right != NULL) {
+        bplus_tree_node* root = bplus_tree_create_node(tree, false);
+        bplus_tree_children(root)[0] = tree->root;
+        bplus_tree_children(root)[1] = right;
+        memcpy(bplus_tree_inner_key(tree, root, 0), tree->split_key, sizeof(byte) * tree->key_size);
+        root->count = 2;
+        tree->root = root;
+        tree->height++;
+    }
+    if (inserted) {
+        tree->size++;
+    }
+    return inserted;
+}
+
+/**
+ * @brief Removes the specified key and its value from the tree.
+ *
+ * @param tree The tree to remove from.
+ * @param key The key to be removed.
+ *
+ * @return Whether or not the key was found and removed.
+ */
+bool bplus_tree_remove(bplus_tree* tree, const void* key) {
+    assert(tree != NULL && tree->root != NULL && key != NULL);
+
+    if (!bplus_tree_remove_from(tree, tree->root, key)) {
+        return false;
+    }
+    if (!tree->root->is_leaf && tree->root->count == 1) {
+        bplus_tree_node* root = tree->root;
+        tree->root = bplus_tree_children(root)[0];
+        free(root);
+        tree->height--;
+    }
+    tree->size--;
+    return true;
+}
+
+/**
+ * @brief Removes all the tree entries.
+ *
+ * @param tree A pointer to the tree to remove from.
+ */
+void bplus_tree_clear(bplus_tree* tree) {
+    assert(tree != NULL && tree->root != NULL);
+
+    bplus_tree_free_nodes(tree->root);
+    tree->root = bplus_tree_create_node(tree, true);
+    tree->first = tree->root;
+    tree->size = 0;
+    tree->height = 1;
+}
+
+/**
+ * @brief Frees the memory allocated for the tree.
+ *
+ * @param tree A pointer to the tree to free from.
+ */
+void bplus_tree_destroy(bplus_tree* tree) {
+    assert(tree != NULL);
+
+    if (tree->root != NULL) {
+        bplus_tree_free_nodes(tree->root);
+    }
+    tree->root = NULL;
+    tree->first = NULL;
+    free(tree->split_key);
+    tree->split_key = NULL;
+    tree->size = 0;
+    tree->height = 0;
+}
+
+/**
+ * @brief Gets the number of entries in the tree.
+ *
+ * @param tree The tree whose size will be returned.
+ *
+ * @return The number of entries in the tree.
+ */
+size_t bplus_tree_size(const bplus_tree* tree) {
+    assert(tree != NULL);
+
+    return tree->size;
+}
+
+/**
+ * @brief Gets the number of levels of the tree, a tree of a single leaf has height one.
+ *
+ * @param tree The tree whose height will be returned.
+ *
+ * @return The height of the tree.
+ */
+size_t bplus_tree_height(const bplus_tree* tree) {
+    assert(tree != NULL);
+
+    return tree->height;
+}
+
+/**
+ * @brief Checks whether the tree is empty or not.
+ *
+ * @param tree The tree to be checked.
+ *
+ * @return Whether or not the tree is empty.
+ */
+bool bplus_tree_is_empty(const bplus_tree* tree) {
+    assert(tree != NULL);
+
+    return tree->size == 0;
+}
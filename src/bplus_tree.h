@@ -0,0 +1,130 @@
+/**
+ * @file     bplus_tree.h
+ *
+ * @brief    The Implementation of the B+Tree Ordered Map.
+ * @author   Hassan Tarek
+ */
+
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+
+/* Struct type declaration */
+struct bplus_tree_node;
+struct bplus_tree;
+struct bplus_tree_iterator;
+
+/* Typedefs */
+typedef struct bplus_tree_node bplus_tree_node;
+typedef struct bplus_tree bplus_tree;
+typedef struct bplus_tree_iterator bplus_tree_iterator;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent a node of the tree.
+ *
+ * A leaf holds count keys followed by their values and is linked to the next
+ * leaf. An inner node holds count children followed by the count - 1 keys
+ * separating them, key i being the smallest key under child i + 1.
+ */
+struct bplus_tree_node {
+    size_t count;
+    bplus_tree_node* next;
+    bool is_leaf;
+    _Alignas(max_align_t) byte data[];
+};
+
+/**
+ * Define the struct represent the B+tree ordered map with fixed size keys and values.
+ *
+ * Every node fits in BPLUS_TREE_NODE_SIZE bytes, a few cache lines, so the
+ * keys of a node are scanned linearly and a lookup touches one node per level.
+ */
+struct bplus_tree {
+    bplus_tree_node* root;
+    bplus_tree_node* first;
+    size_t size;
+    size_t height;
+    size_t key_size;
+    size_t value_size;
+    size_t leaf_capacity;
+    size_t inner_capacity;
+    size_t values_offset;
+    size_t keys_offset;
+    byte* split_key;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+/**
+ * Define the struct represent a position in the ordered leaves of the tree.
+ */
+struct bplus_tree_iterator {
+    const bplus_tree* tree;
+    bplus_tree_node* leaf;
+    size_t index;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void bplus_tree_init(bplus_tree* tree, size_t key_size, size_t value_size,
+                     int (* compare)(const void* lhs, const void* rhs));
+void bplus_tree_bulk_load(bplus_tree* tree, const vector* keys, const vector* values);
+
+/* Accessing */
+void* bplus_tree_find(const bplus_tree* tree, const void* key);
+bool bplus_tree_contains(const bplus_tree* tree, const void* key);
+
+/* Iteration */
+bplus_tree_iterator bplus_tree_begin(const bplus_tree* tree);
+bplus_tree_iterator bplus_tree_lower_bound(const bplus_tree* tree, const void* key);
+bool bplus_tree_iterator_is_valid(const bplus_tree_iterator* iterator);
+void bplus_tree_iterator_next(bplus_tree_iterator* iterator);
+const void* bplus_tree_iterator_key(const bplus_tree_iterator* iterator);
+void* bplus_tree_iterator_value(const bplus_tree_iterator* iterator);
+
+/* Insertion */
+bool bplus_tree_insert(bplus_tree* tree, const void* key, const void* value);
+
+/* Removal */
+bool bplus_tree_remove(bplus_tree* tree, const void* key);
+void bplus_tree_clear(bplus_tree* tree);
+void bplus_tree_destroy(bplus_tree* tree);
+
+/* Utility */
+size_t bplus_tree_size(const bplus_tree* tree);
+size_t bplus_tree_height(const bplus_tree* tree);
+bool bplus_tree_is_empty(const bplus_tree* tree);
+
+
+/* M A C R O S */
+
+#ifndef BPLUS_TREE_NODE_SIZE
+#define BPLUS_TREE_NODE_SIZE 256
+#endif /* BPLUS_TREE_NODE_SIZE */
+
+#define BPLUS_TREE_MIN_CAPACITY 5
+
+#define bplus_tree_for_each(iterator, tree_ptr)                     \
+    for (bplus_tree_iterator iterator = bplus_tree_begin(tree_ptr); \
+         bplus_tree_iterator_is_valid(&iterator);                   \
+         bplus_tree_iterator_next(&iterator))
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BPLUS_TREE_H */
@@ -0,0 +1,522 @@
+#include "compact_list.h"
+
+/**
+ * Define the struct represent the header written before the nodes of a serialized list.
+ */
+typedef struct {
+    uint64_t element_size;
+    uint64_t node_size;
+    compact_index head;
+    compact_index tail;
+    compact_index free_head;
+    compact_index size;
+    compact_index used;
+    compact_index padding;
+} compact_list_header;
+
+/**
+ * @brief Computes the size of a node, padded so the values of consecutive nodes
+ *        keep the alignment of the element, up to 8 bytes.
+ *
+ * @param element_size The size in bytes of each element in the list.
+ *
+ * @return The size in bytes of a node.
+ */
+static size_t compact_list_node_size(size_t element_size) {
+    size_t align = element_size & (~element_size + 1);
+    if (align < sizeof(compact_index))
+        align = sizeof(compact_index);
+    if (align > sizeof(uint64_t))
+        align = sizeof(uint64_t);
+    size_t size = sizeof(compact_node) + element_size;
+    return (size + align - 1) / align * align;
+}
+
+/**
+ * @brief Takes a node from the free chain, or from the unused end of the pool which grows when full.
+ *
+ * @param list The list owning the pool.
+ * @param val The value to be copied into the node.
+ *
+ * @return The index of the node.
+ */
+static compact_index compact_list_create_node(compact_list* list, const void* val) {
+    compact_index position = list->free_head;
+    if (position != COMPACT_LIST_NIL) {
+        list->free_head = compact_list_node(list, position)->next;
+    }
+    else {
+        if (list->used == list->capacity) {
+            assert(list->capacity < COMPACT_LIST_NIL / 2);
+            compact_list_reserve(list, list->capacity > 0 ? (size_t) list->capacity * 2 : COMPACT_LIST_INIT_CAPACITY);
+        }
+        position = list->used++;
+    }
+    memcpy(compact_list_node(list, position)->val, val, list->element_size);
+    return position;
+}
+
+/**
+ * @brief Finds the node at the specified index walking from the closer end of the list.
+ *
+ * @param list The list to be searched.
+ * @param index The index of the node, less than the size.
+ *
+ * @return The index in the pool of the node.
+ */
+static compact_index compact_list_position_at(const compact_list* list, size_t index) {
+    compact_index position;
+    if (index < list->size / 2) {
+        position = list->head;
+        for (size_t i = 0; i < index; i++) {
+            position = compact_list_node(list, position)->next;
+        }
+    }
+    else {
+        position = list->tail;
+        for (size_t i = list->size - 1; i > index; i--) {
+            position = compact_list_node(list, position)->prev;
+        }
+    }
+    return position;
+}
+
+/**
+ * @brief Checks that the links of a deserialized list are in the pool, that the chain
+ *        from head reaches tail through size nodes linked both ways, and that the free
+ *        chain holds every other node of the pool exactly once.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the links are consistent.
+ */
+static bool compact_list_is_consistent(const compact_list* list) {
+    if (list->used == 0) {
+        return list->head == COMPACT_LIST_NIL && list->tail == COMPACT_LIST_NIL &&
+               list->free_head == COMPACT_LIST_NIL;
+    }
+    bool* seen = (bool *) calloc(list->used, sizeof(bool));
+    bool consistent = true;
+    compact_index prev = COMPACT_LIST_NIL;
+    compact_index position = list->head;
+    for (compact_index i = 0; i < list->size && consistent; i++) {
+        consistent = position < list->used && !seen[position] &&
+                     compact_list_node(list, position)->prev == prev;
+        if (consistent) {
+            seen[position] = true;
+            prev = position;
+            position = compact_list_node(list, position)->next;
+        }
+    }
+    consistent = consistent && position == COMPACT_LIST_NIL && prev == list->tail;
+    position = list->free_head;
+    for (compact_index i = list->size; i < list->used && consistent; i++) {
+        consistent = position < list->used && !seen[position];
+        if (consistent) {
+            seen[position] = true;
+            position = compact_list_node(list, position)->next;
+        }
+    }
+    free(seen);
+    return consistent && position == COMPACT_LIST_NIL;
+}
+
+/**
+ * @brief Initialize the compact list.
+ *
+ * @param list The list to be initialized.
+ * @param element_size The size in bytes of each element in the list.
+ */
+void compact_list_init(compact_list* list, size_t element_size) {
+    assert(list != NULL && element_size > 0);
+
+    list->pool = NULL;
+    list->head = COMPACT_LIST_NIL;
+    list->tail = COMPACT_LIST_NIL;
+    list->free_head = COMPACT_LIST_NIL;
+    list->size = 0;
+    list->used = 0;
+    list->capacity = 0;
+    list->element_size = element_size;
+    list->node_size = compact_list_node_size(element_size);
+}
+
+/**
+ * @brief Copies the src list into dest with a single memcpy of the pool.
+ *        Dest must not hold a pool, it is initialized by this function.
+ *
+ * @param src The list to be copied.
+ * @param dest The list receiving the copy.
+ */
+void compact_list_copy(const compact_list* src, compact_list* dest) {
+    assert(src != NULL && dest != NULL && src != dest);
+
+    *dest = *src;
+    dest->pool = NULL;
+    if (src->used > 0) {
+        dest->pool = (byte *) malloc(sizeof(byte) * src->used * src->node_size);
+        memcpy(dest->pool, src->pool, src->used * src->node_size);
+    }
+    dest->capacity = src->used;
+}
+
+/**
+ * @brief Initialize the list from a block written by compact_list_serialize.
+ *
+ * @param list The list to be initialized.
+ * @param buffer The serialized block.
+ * @param buffer_size The size in bytes of the block.
+ *
+ * @return Whether or not the block holds a valid list, the list is left empty when it does not.
+ *         Every link is checked in a walk over the pool, so an untrusted block is safe to load.
+ */
+bool compact_list_deserialize(compact_list* list, const void* buffer, size_t buffer_size) {
+    assert(list != NULL && buffer != NULL);
+
+    compact_list_header header;
+    if (buffer_size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, buffer, sizeof(header));
+    size_t payload = buffer_size - sizeof(header);
+    if (header.element_size == 0 || header.node_size <= header.element_size ||
+        header.node_size != compact_list_node_size(header.element_size) ||
+        header.size > header.used || header.used == COMPACT_LIST_NIL ||
+        payload % header.node_size != 0 || payload / header.node_size != header.used) {
+        return false;
+    }
+    compact_list_init(list, header.element_size);
+    if (header.used > 0) {
+        list->pool = (byte *) malloc(sizeof(byte) * payload);
+        memcpy(list->pool, (const byte *) buffer + sizeof(header), payload);
+    }
+    list->head = header.head;
+    list->tail = header.tail;
+    list->free_head = header.free_head;
+    list->size = header.size;
+    list->used = header.used;
+    list->capacity = header.used;
+    if (!compact_list_is_consistent(list)) {
+        compact_list_clear(list);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Retrieves the last element of the specified list.
+ *
+ * @param list The list whose last element wanted to be retrieved.
+ *
+ * @return A pointer to the last element or NULL if the list is empty.
+ */
+void* compact_list_back(const compact_list* list) {
+    assert(list != NULL);
+
+    return list->size > 0 ? compact_list_node(list, list->tail)->val : NULL;
+}
+
+/**
+ * @brief Retrieves the first element of the specified list.
+ *
+ * @param list The list whose first element wanted to be retrieved.
+ *
+ * @return A pointer to the first element or NULL if the list is empty.
+ */
+void* compact_list_front(const compact_list* list) {
+    assert(list != NULL);
+
+    return list->size > 0 ? compact_list_node(list, list->head)->val : NULL;
+}
+
+/**
+ * @brief Retrieves the element at the specified index.
+ *
+ * @param list The list whose element wanted to be retrieved.
+ * @param index The index of the wanted element.
+ *
+ * @return A pointer to the element at the specified index.
+ */
+void* compact_list_at(const compact_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    return compact_list_node(list, compact_list_position_at(list, index))->val;
+}
+
+/**
+ * @brief Retrieves the element of the node at the specified position of the pool.
+ *        The pointer is valid until the next insertion.
+ *
+ * @param list The list whose element wanted to be retrieved.
+ * @param position The index in the pool of a node of the list.
+ *
+ * @return A pointer to the element of the node.
+ */
+void* compact_list_get(const compact_list* list, compact_index position) {
+    assert(list != NULL && position < list->used);
+
+    return compact_list_node(list, position)->val;
+}
+
+/**
+ * @brief Retrieves the index of the specified value or -1 if it's not found.
+ *
+ * @param list The list to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int compact_list_index_of(const compact_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    int index = 0;
+    compact_list_for_each(position, list) {
+        if (memcmp(compact_list_node(list, position)->val, val, list->element_size) == 0) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void compact_list_push_back(compact_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    compact_list_insert_before(list, COMPACT_LIST_NIL, val);
+}
+
+/**
+ * @brief Insert a copy of the specified value into the front of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void compact_list_push_front(compact_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    compact_list_insert_before(list, list->head, val);
+}
+
+/**
+ * @brief Insert a copy of the specified value at the specified index.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ * @param index The index at which the value will be added.
+ */
+void compact_list_insert_at(compact_list* list, const void* val, size_t index) {
+    assert(list != NULL && val != NULL && index <= list->size);
+
+    compact_list_insert_before(list, index < list->size ? compact_list_position_at(list, index) : COMPACT_LIST_NIL, val);
+}
+
+/**
+ * @brief Insert a copy of the specified value before the specified node.
+ *
+ * @param list A pointer to a list to add to.
+ * @param position The node which will follow the new one, or COMPACT_LIST_NIL to add at the end.
+ * @param val The value to be added to the list.
+ *
+ * @return The position of the new node.
+ */
+compact_index compact_list_insert_before(compact_list* list, compact_index position, const void* val) {
+    assert(list != NULL && val != NULL && (position == COMPACT_LIST_NIL || position < list->used));
+
+    compact_index new_position = compact_list_create_node(list, val);
+    compact_node* new_node = compact_list_node(list, new_position);
+    compact_index prev = position != COMPACT_LIST_NIL ? compact_list_node(list, position)->prev : list->tail;
+    new_node->next = position;
+    new_node->prev = prev;
+    if (prev != COMPACT_LIST_NIL)
+        compact_list_node(list, prev)->next = new_position;
+    else
+        list->head = new_position;
+    if (position != COMPACT_LIST_NIL)
+        compact_list_node(list, position)->prev = new_position;
+    else
+        list->tail = new_position;
+    list->size++;
+    return new_position;
+}
+
+/**
+ * @brief Remove the last element from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void compact_list_pop_back(compact_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    compact_list_erase(list, list->tail);
+}
+
+/**
+ * @brief Remove the first element from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void compact_list_pop_front(compact_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    compact_list_erase(list, list->head);
+}
+
+/**
+ * @brief Remove the element at the specified index.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param index The index of the element to be removed.
+ */
+void compact_list_remove_at(compact_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    compact_list_erase(list, compact_list_position_at(list, index));
+}
+
+/**
+ * @brief Unlinks the specified node and puts it on the free chain.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param position The node to be removed.
+ *
+ * @return The position of the node which followed the removed one, or COMPACT_LIST_NIL.
+ */
+compact_index compact_list_erase(compact_list* list, compact_index position) {
+    assert(list != NULL && list->size > 0 && position < list->used);
+
+    compact_node* node = compact_list_node(list, position);
+    compact_index next = node->next;
+    if (node->prev != COMPACT_LIST_NIL)
+        compact_list_node(list, node->prev)->next = next;
+    else
+        list->head = next;
+    if (next != COMPACT_LIST_NIL)
+        compact_list_node(list, next)->prev = node->prev;
+    else
+        list->tail = node->prev;
+    node->next = list->free_head;
+    list->free_head = position;
+    list->size--;
+    return next;
+}
+
+/**
+ * @brief Remove all the elements from the specified list and free its pool.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void compact_list_clear(compact_list* list) {
+    assert(list != NULL);
+
+    free(list->pool);
+    compact_list_init(list, list->element_size);
+}
+
+/**
+ * @brief Gets the number of elements in the specified list.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The number of elements in the list.
+ */
+size_t compact_list_size(const compact_list* list) {
+    assert(list != NULL);
+
+    return list->size;
+}
+
+/**
+ * @brief Gets the number of nodes the pool of the specified list can hold.
+ *
+ * @param list The list whose capacity will be returned.
+ *
+ * @return The number of nodes in the pool.
+ */
+size_t compact_list_capacity(const compact_list* list) {
+    assert(list != NULL);
+
+    return list->capacity;
+}
+
+/**
+ * @brief Checks whether the list is empty or not.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool compact_list_is_empty(const compact_list* list) {
+    assert(list != NULL);
+
+    return list->size == 0;
+}
+
+/**
+ * @brief Grows the pool of the list so it holds at least new_capacity nodes.
+ *
+ * @param list The list for which we will reserve a space.
+ * @param new_capacity The number of nodes to reserve.
+ */
+void compact_list_reserve(compact_list* list, size_t new_capacity) {
+    assert(list != NULL && new_capacity < COMPACT_LIST_NIL);
+
+    if (new_capacity <= list->capacity) {
+        return;
+    }
+    list->pool = (byte *) realloc(list->pool, sizeof(byte) * new_capacity * list->node_size);
+    list->capacity = (compact_index) new_capacity;
+}
+
+/**
+ * @brief Copies the list elements to the specified array.
+ *
+ * @param list The list whose elements will be copied.
+ * @param array The array to be filled, it must hold size elements.
+ */
+void compact_list_copy_to_array(const compact_list* list, void* array) {
+    assert(list != NULL && array != NULL);
+
+    byte* dest = (byte *) array;
+    compact_list_for_each(position, list) {
+        memcpy(dest, compact_list_node(list, position)->val, list->element_size);
+        dest += list->element_size;
+    }
+}
+
+/**
+ * @brief Gets the size in bytes of the block written by compact_list_serialize.
+ *
+ * @param list The list to be serialized.
+ *
+ * @return The size in bytes of the serialized list.
+ */
+size_t compact_list_serialized_size(const compact_list* list) {
+    assert(list != NULL);
+
+    return sizeof(compact_list_header) + list->used * list->node_size;
+}
+
+/**
+ * @brief Writes the list as a single block, a small header followed by the used part of the pool.
+ *
+ * @param list The list to be serialized.
+ * @param buffer The buffer to be filled, it must hold compact_list_serialized_size bytes.
+ */
+void compact_list_serialize(const compact_list* list, void* buffer) {
+    assert(list != NULL && buffer != NULL);
+
+    compact_list_header header = {
+            list->element_size, list->node_size,
+            list->head, list->tail, list->free_head, list->size, list->used, 0
+    };
+    memcpy(buffer, &header, sizeof(header));
+    if (list->used > 0) {
+        memcpy((byte *) buffer + sizeof(header), list->pool, list->used * list->node_size);
+    }
+}
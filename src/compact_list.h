@@ -0,0 +1,117 @@
+/**
+ * @file     compact_list.h
+ *
+ * @brief    The Implementation of Array-Backed Doubly Linked List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct compact_node;
+struct compact_list;
+
+/* Typedefs */
+typedef struct compact_node compact_node;
+typedef struct compact_list compact_list;
+typedef uint32_t compact_index;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the node that make compact list, its links are
+ * indices of nodes in the pool of the list instead of pointers.
+ */
+struct compact_node {
+    compact_index next;
+    compact_index prev;
+    byte val[];
+};
+
+/**
+ * Define the struct represent the array-backed doubly linked list.
+ *
+ * All the nodes live in one contiguous pool and a node costs 8 bytes of
+ * links on top of its value. A removed node is kept on the free chain for
+ * the next insertion. Since the links are indices, the pool stays valid
+ * when it is moved by realloc or memcpy and is serialized as a single block.
+ */
+struct compact_list {
+    byte* pool;
+    compact_index head;
+    compact_index tail;
+    compact_index free_head;
+    compact_index size;
+    compact_index used;
+    compact_index capacity;
+    size_t element_size;
+    size_t node_size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void compact_list_init(compact_list* list, size_t element_size);
+void compact_list_copy(const compact_list* src, compact_list* dest);
+bool compact_list_deserialize(compact_list* list, const void* buffer, size_t buffer_size);
+
+/* Accessing */
+void* compact_list_back(const compact_list* list);
+void* compact_list_front(const compact_list* list);
+void* compact_list_at(const compact_list* list, size_t index);
+void* compact_list_get(const compact_list* list, compact_index position);
+int compact_list_index_of(const compact_list* list, const void* val);
+
+/* Insertion */
+void compact_list_push_back(compact_list* list, const void* val);
+void compact_list_push_front(compact_list* list, const void* val);
+void compact_list_insert_at(compact_list* list, const void* val, size_t index);
+compact_index compact_list_insert_before(compact_list* list, compact_index position, const void* val);
+
+/* Removal */
+void compact_list_pop_back(compact_list* list);
+void compact_list_pop_front(compact_list* list);
+void compact_list_remove_at(compact_list* list, size_t index);
+compact_index compact_list_erase(compact_list* list, compact_index position);
+void compact_list_clear(compact_list* list);
+
+/* Utility */
+size_t compact_list_size(const compact_list* list);
+size_t compact_list_capacity(const compact_list* list);
+bool compact_list_is_empty(const compact_list* list);
+void compact_list_reserve(compact_list* list, size_t new_capacity);
+void compact_list_copy_to_array(const compact_list* list, void* array);
+size_t compact_list_serialized_size(const compact_list* list);
+void compact_list_serialize(const compact_list* list, void* buffer);
+
+
+/* M A C R O S */
+
+#define COMPACT_LIST_NIL ((compact_index) UINT32_MAX)
+#define COMPACT_LIST_INIT_CAPACITY 16
+
+#define compact_list_node(list_ptr, position) \
+    ((compact_node *) ((list_ptr)->pool + (size_t) (position) * (list_ptr)->node_size))
+
+#define compact_list_for_each(position, list_ptr)                 \
+    for (compact_index position = (list_ptr)->head;               \
+         position != COMPACT_LIST_NIL;                            \
+         position = compact_list_node(list_ptr, position)->next)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* COMPACT_LIST_H */
@@ -0,0 +1,412 @@
+#include "external_sort.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#endif
+
+/**
+ * Define the struct represent the read side of one sorted run during the merge.
+ */
+typedef struct external_sort_reader {
+    FILE* file;
+    byte* block;
+    size_t count;
+    size_t index;
+} external_sort_reader;
+
+/**
+ * Define the struct represent the output file of external_sort_finish_file.
+ */
+typedef struct external_sort_writer {
+    FILE* file;
+    size_t element_size;
+} external_sort_writer;
+
+/**
+ * @brief Asks the system to read ahead the specified file since it is read sequentially.
+ *
+ * @param file The file to be read.
+ */
+static void external_sort_advise_sequential(FILE* file) {
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(fileno(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#else
+    (void) file;
+#endif
+}
+
+/**
+ * @brief Sorts the in-memory chunk and writes it to a new temporary file as a run.
+ *
+ * @param sort The external sort whose chunk will be spilled.
+ *
+ * @return Whether or not the run was written.
+ */
+static bool external_sort_spill(external_sort* sort) {
+    if (sort->chunk_size == 0) {
+        return true;
+    }
+    FILE* file = tmpfile();
+    if (file == NULL) {
+        return false;
+    }
+    qsort(sort->chunk, sort->chunk_size, sort->element_size, sort->compare);
+    if (fwrite(sort->chunk, sort->element_size, sort->chunk_size, file) != sort->chunk_size ||
+        fflush(file) != 0) {
+        fclose(file);
+        return false;
+    }
+    vector_push_back(&sort->runs, &file);
+    sort->chunk_size = 0;
+    return true;
+}
+
+/**
+ * @brief Reads the next block of the run into the reader.
+ *
+ * @param reader The reader to be refilled.
+ * @param block_capacity The number of elements the block can hold.
+ * @param element_size The size in bytes of each element.
+ *
+ * @return Whether or not any element was read.
+ */
+static bool external_sort_refill(external_sort_reader* reader, size_t block_capacity, size_t element_size) {
+    reader->count = fread(reader->block, element_size, block_capacity, reader->file);
+    reader->index = 0;
+    return reader->count > 0;
+}
+
+/**
+ * @brief Retrieves the current element of the specified reader.
+ *
+ * @param reader The reader.
+ * @param element_size The size in bytes of each element.
+ *
+ * @return A pointer to the current element.
+ */
+static const byte* external_sort_current(const external_sort_reader* reader, size_t element_size) {
+    return reader->block + reader->index * element_size;
+}
+
+/**
+ * @brief Restores the min-heap order of the readers starting from the specified position.
+ *
+ * @param sort The external sort holding the comparator.
+ * @param readers The readers.
+ * @param heap The heap of reader indices.
+ * @param heap_size The number of readers in the heap.
+ * @param index The position to sift down from.
+ */
+static void external_sort_sift_down(const external_sort* sort, const external_sort_reader* readers,
+                                    size_t* heap, size_t heap_size, size_t index) {
+    while (true) {
+        size_t smallest = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        if (left < heap_size &&
+            sort->compare(external_sort_current(&readers[heap[left]], sort->element_size),
+                          external_sort_current(&readers[heap[smallest]], sort->element_size)) < 0) {
+            smallest = left;
+        }
+        if (right < heap_size &&
+            sort->compare(external_sort_current(&readers[heap[right]], sort->element_size),
+                          external_sort_current(&readers[heap[smallest]], sort->element_size)) < 0) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            return;
+        }
+        size_t temp = heap[index];
+        heap[index] = heap[smallest];
+        heap[smallest] = temp;
+        index = smallest;
+    }
+}
+
+/**
+ * @brief Merges all the spilled runs into the sink with a k-way heap merge.
+ *
+ * @param sort The external sort whose runs will be merged.
+ * @param sink The function receiving the elements in order.
+ * @param context The user data passed to the sink.
+ *
+ * @return Whether or not all the elements reached the sink.
+ */
+static bool external_sort_merge(external_sort* sort, external_sort_sink sink, void* context) {
+    size_t run_count = vector_size(&sort->runs);
+    FILE** files = (FILE **) vector_get_data(&sort->runs);
+    size_t block_capacity = sort->memory_budget / (run_count * sort->element_size);
+    if (block_capacity == 0) {
+        block_capacity = 1;
+    }
+
+    external_sort_reader* readers = (external_sort_reader *) malloc(sizeof(external_sort_reader) * run_count);
+    size_t* heap = (size_t *) malloc(sizeof(size_t) * run_count);
+    byte* blocks = (byte *) malloc(sizeof(byte) * run_count * block_capacity * sort->element_size);
+    size_t heap_size = 0;
+    bool ok = true;
+    for (size_t i = 0; i < run_count; i++) {
+        readers[i].file = files[i];
+        readers[i].block = blocks + i * block_capacity * sort->element_size;
+        rewind(files[i]);
+        external_sort_advise_sequential(files[i]);
+        if (external_sort_refill(&readers[i], block_capacity, sort->element_size)) {
+            heap[heap_size++] = i;
+        }
+    }
+    for (size_t i = heap_size; i > 0; i--) {
+        external_sort_sift_down(sort, readers, heap, heap_size, i - 1);
+    }
+
+    while (heap_size > 0 && ok) {
+        external_sort_reader* reader = &readers[heap[0]];
+        ok = sink(external_sort_current(reader, sort->element_size), context);
+        reader->index++;
+        if (reader->index == reader->count &&
+            !external_sort_refill(reader, block_capacity, sort->element_size)) {
+            ok = ok && !ferror(reader->file);
+            heap[0] = heap[--heap_size];
+        }
+        external_sort_sift_down(sort, readers, heap, heap_size, 0);
+    }
+
+    free(blocks);
+    free(heap);
+    free(readers);
+    return ok;
+}
+
+/**
+ * @brief Appends the specified element to the buffered output file.
+ *
+ * @param val The element to be written.
+ * @param context The external_sort_writer of the output file.
+ *
+ * @return Whether or not the element was written.
+ */
+static bool external_sort_file_sink(const void* val, void* context) {
+    external_sort_writer* writer = (external_sort_writer *) context;
+    return fwrite(val, writer->element_size, 1, writer->file) == 1;
+}
+
+/**
+ * @brief Initialize the external sort.
+ *
+ * @param sort The external sort to be initialized.
+ * @param element_size The size in bytes of each element.
+ * @param memory_budget The maximum number of bytes used to hold the elements in memory.
+ * @param compare The compare function used to sort the elements, as for vector_sort.
+ */
+void external_sort_init(external_sort* sort, size_t element_size, size_t memory_budget,
+                        int (* compare)(const void* lhs, const void* rhs)) {
+    assert(sort != NULL && element_size > 0 && memory_budget >= element_size && compare != NULL);
+
+    sort->chunk_capacity = memory_budget / element_size;
+    sort->chunk = (byte *) malloc(sizeof(byte) * sort->chunk_capacity * element_size);
+    sort->chunk_size = 0;
+    sort->element_size = element_size;
+    sort->memory_budget = memory_budget;
+    sort->size = 0;
+    sort->compare = compare;
+    vector_init(&sort->runs, sizeof(FILE *));
+}
+
+/**
+ * @brief Adds the specified element to the sort, spilling the chunk once it is full.
+ *
+ * @param sort A pointer to the external sort to add to.
+ * @param val The element to be added.
+ *
+ * @return Whether or not the element was added, false if a spill failed.
+ */
+bool external_sort_push(external_sort* sort, const void* val) {
+    return external_sort_push_array(sort, val, 1);
+}
+
+/**
+ * @brief Adds the elements of the specified array to the sort.
+ *
+ * @param sort A pointer to the external sort to add to.
+ * @param array The elements to be added.
+ * @param array_size The number of elements in the specified array.
+ *
+ * @return Whether or not the elements were added, false if a spill failed.
+ */
+bool external_sort_push_array(external_sort* sort, const void* array, size_t array_size) {
+    assert(sort != NULL && sort->chunk != NULL && array != NULL);
+
+    const byte* src = (const byte *) array;
+    while (array_size > 0) {
+        if (sort->chunk_size == sort->chunk_capacity && !external_sort_spill(sort)) {
+            return false;
+        }
+        size_t count = sort->chunk_capacity - sort->chunk_size;
+        if (count > array_size) {
+            count = array_size;
+        }
+        memcpy(sort->chunk + sort->chunk_size * sort->element_size, src, count * sort->element_size);
+        sort->chunk_size += count;
+        sort->size += count;
+        src += count * sort->element_size;
+        array_size -= count;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds all the elements stored in the specified binary file to the sort,
+ *        reading whole chunks straight into memory.
+ *
+ * @param sort A pointer to the external sort to add to.
+ * @param file The file to read from its current position to its end.
+ *
+ * @return Whether or not the elements were added, false on a read or spill failure.
+ */
+bool external_sort_push_file(external_sort* sort, FILE* file) {
+    assert(sort != NULL && sort->chunk != NULL && file != NULL);
+
+    external_sort_advise_sequential(file);
+    while (true) {
+        if (sort->chunk_size == sort->chunk_capacity && !external_sort_spill(sort)) {
+            return false;
+        }
+        size_t count = fread(sort->chunk + sort->chunk_size * sort->element_size, sort->element_size,
+                             sort->chunk_capacity - sort->chunk_size, file);
+        sort->chunk_size += count;
+        sort->size += count;
+        if (count == 0) {
+            return !ferror(file);
+        }
+    }
+}
+
+/**
+ * @brief Delivers all the elements in sorted order to the specified sink.
+ *
+ * When everything fits in one chunk it is sorted in memory, otherwise the
+ * last chunk is spilled and the runs are merged. The sort must be destroyed
+ * afterwards and cannot be reused.
+ *
+ * @param sort A pointer to the external sort to finish.
+ * @param sink The function receiving the elements in order, returning false stops the merge.
+ * @param context The user data passed to the sink.
+ *
+ * @return Whether or not all the elements reached the sink.
+ */
+bool external_sort_finish(external_sort* sort, external_sort_sink sink, void* context) {
+    assert(sort != NULL && sort->chunk != NULL && sink != NULL);
+
+    if (vector_is_empty(&sort->runs)) {
+        qsort(sort->chunk, sort->chunk_size, sort->element_size, sort->compare);
+        for (size_t i = 0; i < sort->chunk_size; i++) {
+            if (!sink(sort->chunk + i * sort->element_size, context)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (!external_sort_spill(sort)) {
+        return false;
+    }
+    // The chunk memory is handed over to the merge blocks.
+    free(sort->chunk);
+    sort->chunk = NULL;
+    return external_sort_merge(sort, sink, context);
+}
+
+/**
+ * @brief Writes all the elements in sorted order to the specified binary file.
+ *
+ * @param sort A pointer to the external sort to finish.
+ * @param file The file to write to from its current position, its buffering is left to the caller.
+ *
+ * @return Whether or not all the elements were written.
+ */
+bool external_sort_finish_file(external_sort* sort, FILE* file) {
+    assert(sort != NULL && file != NULL);
+
+    external_sort_writer writer = {file, sort->element_size};
+    return external_sort_finish(sort, external_sort_file_sink, &writer) && fflush(file) == 0;
+}
+
+/**
+ * @brief Frees the memory and the temporary files of the external sort.
+ *
+ * @param sort A pointer to the external sort to free from.
+ */
+void external_sort_destroy(external_sort* sort) {
+    assert(sort != NULL);
+
+    vector_for_each(index, &sort->runs) {
+        fclose(((FILE **) vector_get_data(&sort->runs))[index]);
+    }
+    vector_destroy(&sort->runs);
+    free(sort->chunk);
+    sort->chunk = NULL;
+    sort->chunk_size = 0;
+    sort->size = 0;
+}
+
+/**
+ * @brief Gets the number of elements added to the sort.
+ *
+ * @param sort The external sort whose size will be returned.
+ *
+ * @return The number of elements added.
+ */
+size_t external_sort_size(const external_sort* sort) {
+    assert(sort != NULL);
+
+    return sort->size;
+}
+
+/**
+ * @brief Gets the number of runs spilled to temporary files so far.
+ *
+ * @param sort The external sort whose runs will be counted.
+ *
+ * @return The number of spilled runs.
+ */
+size_t external_sort_run_count(const external_sort* sort) {
+    assert(sort != NULL);
+
+    return vector_size(&sort->runs);
+}
+
+/**
+ * @brief Sorts the binary file of fixed size elements at input_path into output_path
+ *        using at most memory_budget bytes for the elements.
+ *
+ * @param input_path The path of the file to be sorted.
+ * @param output_path The path of the sorted file to be written.
+ * @param element_size The size in bytes of each element.
+ * @param memory_budget The maximum number of bytes used to hold the elements in memory.
+ * @param compare The compare function used to sort the elements, as for vector_sort.
+ *
+ * @return Whether or not the output file was written.
+ */
+bool external_sort_file(const char* input_path, const char* output_path, size_t element_size,
+                        size_t memory_budget, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(input_path != NULL && output_path != NULL);
+
+    FILE* input = fopen(input_path, "rb");
+    if (input == NULL) {
+        return false;
+    }
+    setvbuf(input, NULL, _IOFBF, EXTERNAL_SORT_IO_BLOCK);
+    external_sort sort;
+    external_sort_init(&sort, element_size, memory_budget, compare);
+    bool ok = external_sort_push_file(&sort, input);
+    fclose(input);
+
+    FILE* output = ok ? fopen(output_path, "wb") : NULL;
+    if (output != NULL) {
+        setvbuf(output, NULL, _IOFBF, EXTERNAL_SORT_IO_BLOCK);
+    }
+    ok = output != NULL && external_sort_finish_file(&sort, output);
+    if (output != NULL && fclose(output) != 0) {
+        ok = false;
+    }
+    external_sort_destroy(&sort);
+    return ok;
+}
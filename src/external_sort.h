@@ -0,0 +1,85 @@
+/**
+ * @file     external_sort.h
+ *
+ * @brief    The Implementation of the External Merge Sort.
+ * @author   Hassan Tarek
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+
+/* Struct type declaration */
+struct external_sort;
+
+/* Typedefs */
+typedef struct external_sort external_sort;
+typedef uint8_t byte;
+typedef bool (* external_sort_sink)(const void* val, void* context);
+
+/**
+ * Define the struct represent an external sort in progress.
+ *
+ * The elements are gathered in an in-memory chunk of at most memory_budget
+ * bytes, every full chunk is sorted and spilled to a temporary file as a run,
+ * and the runs are merged back when the sort is finished.
+ */
+struct external_sort {
+    byte* chunk;
+    size_t chunk_size;
+    size_t chunk_capacity;
+    size_t element_size;
+    size_t memory_budget;
+    size_t size;
+    vector runs;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void external_sort_init(external_sort* sort, size_t element_size, size_t memory_budget,
+                        int (* compare)(const void* lhs, const void* rhs));
+
+/* Insertion */
+bool external_sort_push(external_sort* sort, const void* val);
+bool external_sort_push_array(external_sort* sort, const void* array, size_t array_size);
+bool external_sort_push_file(external_sort* sort, FILE* file);
+
+/* Merging */
+bool external_sort_finish(external_sort* sort, external_sort_sink sink, void* context);
+bool external_sort_finish_file(external_sort* sort, FILE* file);
+
+/* Removal */
+void external_sort_destroy(external_sort* sort);
+
+/* Utility */
+size_t external_sort_size(const external_sort* sort);
+size_t external_sort_run_count(const external_sort* sort);
+bool external_sort_file(const char* input_path, const char* output_path, size_t element_size,
+                        size_t memory_budget, int (* compare)(const void* lhs, const void* rhs));
+
+
+/* M A C R O S */
+
+#define EXTERNAL_SORT_IO_BLOCK (1 << 20)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* EXTERNAL_SORT_H */
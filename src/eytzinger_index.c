@@ -0,0 +1,183 @@
+#include "eytzinger_index.h"
+
+/**
+ * @brief Fills the subtree rooted at the specified slot with the next sorted elements (in-order).
+ *
+ * @param index The index being built.
+ * @param sorted The sorted elements.
+ * @param rank The rank of the next sorted element to be placed.
+ * @param slot The root slot of the subtree.
+ *
+ * @return The rank of the next sorted element after the subtree.
+ */
+static size_t eytzinger_index_build(eytzinger_index* index, const byte* sorted, size_t rank, size_t slot) {
+    if (slot > index->size) {
+        return rank;
+    }
+    rank = eytzinger_index_build(index, sorted, rank, 2 * slot);
+    memcpy(index->data + slot * index->element_size, sorted + rank * index->element_size,
+           sizeof(byte) * index->element_size);
+    index->ranks[slot] = rank;
+    rank++;
+    return eytzinger_index_build(index, sorted, rank, 2 * slot + 1);
+}
+
+/**
+ * @brief Maps the slot past the leaves where a descent stopped to the slot of the lower bound.
+ *
+ * The descent went right past every smaller element, so dropping the trailing
+ * right turns and the last left turn gives the slot of the lower bound.
+ *
+ * @param slot The slot where the descent stopped.
+ *
+ * @return The slot of the lower bound or zero if all elements are smaller.
+ */
+static size_t eytzinger_index_unwind(size_t slot) {
+#if defined(__GNUC__) || defined(__clang__)
+    return slot >> (__builtin_ctzll(~(unsigned long long) slot) + 1);
+#else
+    while (slot & 1) {
+        slot >>= 1;
+    }
+    return slot >> 1;
+#endif
+}
+
+/**
+ * @brief Finds the slot of the first element which is not less than the specified key.
+ *
+ * The descent has no branch on the comparison result and prefetches the
+ * grandchildren of every visited slot, which sit next to each other.
+ *
+ * @param index The index to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return The slot of the lower bound or zero if all elements are smaller.
+ */
+static size_t eytzinger_index_descend(const eytzinger_index* index, const void* key) {
+    size_t slot = 1;
+    while (slot <= index->size) {
+        EYTZINGER_INDEX_PREFETCH(index->data + 4 * slot * index->element_size);
+        slot = 2 * slot + (index->compare(index->data + slot * index->element_size, key) < 0);
+    }
+    return eytzinger_index_unwind(slot);
+}
+
+/**
+ * @brief Initialize the search index from the specified sorted vector, which is copied.
+ *
+ * @param index The index to be initialized.
+ * @param sorted The vector sorted by the compare function.
+ * @param compare The compare function the vector is sorted by, as for vector_sort.
+ */
+void eytzinger_index_init(eytzinger_index* index, const vector* sorted,
+                          int (* compare)(const void* lhs, const void* rhs)) {
+    assert(index != NULL && sorted != NULL && sorted->data != NULL && compare != NULL);
+
+    index->size = sorted->size;
+    index->element_size = sorted->element_size;
+    index->compare = compare;
+    index->data = (byte *) malloc(sizeof(byte) * (sorted->size + 1) * sorted->element_size);
+    index->ranks = (size_t *) malloc(sizeof(size_t) * (sorted->size + 1));
+    eytzinger_index_build(index, sorted->data, 0, 1);
+}
+
+/**
+ * @brief Finds the first element which is not less than the specified key.
+ *
+ * @param index The index to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return The index in the sorted vector of the lower bound or the size if all elements are smaller.
+ */
+size_t eytzinger_index_lower_bound(const eytzinger_index* index, const void* key) {
+    assert(index != NULL && key != NULL);
+
+    size_t slot = eytzinger_index_descend(index, key);
+    return slot == 0 ? index->size : index->ranks[slot];
+}
+
+/**
+ * @brief Finds the lower bound of many keys at once.
+ *
+ * The keys descend in lockstep groups of EYTZINGER_INDEX_BATCH so the
+ * memory accesses of different keys overlap instead of waiting on each other.
+ *
+ * @param index The index to be searched.
+ * @param keys The keys to be searched for.
+ * @param count The number of keys.
+ * @param results The array receiving the lower bound of every key.
+ */
+void eytzinger_index_lower_bound_batch(const eytzinger_index* index, const void* keys, size_t count,
+                                       size_t* results) {
+    assert(index != NULL && (keys != NULL || count == 0) && (results != NULL || count == 0));
+
+    const byte* key_bytes = (const byte *) keys;
+    size_t slots[EYTZINGER_INDEX_BATCH];
+    for (size_t first = 0; first < count; first += EYTZINGER_INDEX_BATCH) {
+        size_t batch = count - first < EYTZINGER_INDEX_BATCH ? count - first : EYTZINGER_INDEX_BATCH;
+        for (size_t i = 0; i < batch; i++) {
+            slots[i] = 1;
+        }
+        bool active = index->size > 0;
+        while (active) {
+            active = false;
+            for (size_t i = 0; i < batch; i++) {
+                size_t slot = slots[i];
+                if (slot <= index->size) {
+                    EYTZINGER_INDEX_PREFETCH(index->data + 4 * slot * index->element_size);
+                    const byte* key = key_bytes + (first + i) * index->element_size;
+                    slots[i] = 2 * slot + (index->compare(index->data + slot * index->element_size, key) < 0);
+                    active = true;
+                }
+            }
+        }
+        for (size_t i = 0; i < batch; i++) {
+            size_t slot = eytzinger_index_unwind(slots[i]);
+            results[first + i] = slot == 0 ? index->size : index->ranks[slot];
+        }
+    }
+}
+
+/**
+ * @brief Checks whether or not the specified key is in the index.
+ *
+ * @param index The index to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return Whether or not an element equal to the key exists.
+ */
+bool eytzinger_index_contains(const eytzinger_index* index, const void* key) {
+    assert(index != NULL && key != NULL);
+
+    size_t slot = eytzinger_index_descend(index, key);
+    return slot != 0 && index->compare(index->data + slot * index->element_size, key) == 0;
+}
+
+/**
+ * @brief Frees the memory allocated for the index.
+ *
+ * @param index A pointer to the index to free from.
+ */
+void eytzinger_index_destroy(eytzinger_index* index) {
+    assert(index != NULL);
+
+    free(index->data);
+    index->data = NULL;
+    free(index->ranks);
+    index->ranks = NULL;
+    index->size = 0;
+}
+
+/**
+ * @brief Gets the number of elements in the index.
+ *
+ * @param index The index whose size will be returned.
+ *
+ * @return The number of elements in the index.
+ */
+size_t eytzinger_index_size(const eytzinger_index* index) {
+    assert(index != NULL);
+
+    return index->size;
+}
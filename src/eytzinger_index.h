@@ -0,0 +1,81 @@
+/**
+ * @file     eytzinger_index.h
+ *
+ * @brief    The Implementation of the Eytzinger Layout Search Index.
+ * @author   Hassan Tarek
+ */
+
+#ifndef EYTZINGER_INDEX_H
+#define EYTZINGER_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+
+/* Struct type declaration */
+struct eytzinger_index;
+
+/* Typedefs */
+typedef struct eytzinger_index eytzinger_index;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent a read-only search index over a sorted vector.
+ *
+ * The elements are stored in breadth-first order of the implicit binary
+ * search tree (slot k has its children at 2k and 2k + 1, slot 0 is unused),
+ * so the first levels of every search share the same few cache lines.
+ * The ranks map each slot back to its index in the sorted vector.
+ */
+struct eytzinger_index {
+    byte* data;
+    size_t* ranks;
+    size_t size;
+    size_t element_size;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void eytzinger_index_init(eytzinger_index* index, const vector* sorted,
+                          int (* compare)(const void* lhs, const void* rhs));
+
+/* Searching */
+size_t eytzinger_index_lower_bound(const eytzinger_index* index, const void* key);
+void eytzinger_index_lower_bound_batch(const eytzinger_index* index, const void* keys, size_t count,
+                                       size_t* results);
+bool eytzinger_index_contains(const eytzinger_index* index, const void* key);
+
+/* Removal */
+void eytzinger_index_destroy(eytzinger_index* index);
+
+/* Utility */
+size_t eytzinger_index_size(const eytzinger_index* index);
+
+
+/* M A C R O S */
+
+#define EYTZINGER_INDEX_BATCH 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define EYTZINGER_INDEX_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define EYTZINGER_INDEX_PREFETCH(address) ((void) (address))
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* EYTZINGER_INDEX_H */
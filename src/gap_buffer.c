@@ -0,0 +1,301 @@
+#include "gap_buffer.h"
+
+/**
+ * @brief Retrieves a pointer to the storage of the element at the specified logical index.
+ *
+ * @param buffer The gap buffer to be accessed.
+ * @param index The logical index of the element.
+ *
+ * @return A pointer to the element storage.
+ */
+static byte* gap_buffer_slot(const gap_buffer* buffer, size_t index) {
+    size_t physical = index < buffer->gap_start ? index : index + (buffer->gap_end - buffer->gap_start);
+    return buffer->data + physical * buffer->element_size;
+}
+
+/**
+ * @brief Grows the gap so it can hold at least one more element.
+ *
+ * @param buffer The gap buffer to grow.
+ */
+static void gap_buffer_grow(gap_buffer* buffer) {
+    if (buffer->gap_start == buffer->gap_end) {
+        gap_buffer_reserve(buffer, buffer->capacity * 2 + 1);
+    }
+}
+
+/**
+ * @brief Initialize the gap buffer.
+ *
+ * @param buffer The gap buffer to be initialized.
+ * @param element_size The size in bytes of each element in the gap buffer.
+ */
+void gap_buffer_init(gap_buffer* buffer, size_t element_size) {
+    assert(buffer != NULL && element_size > 0);
+
+    buffer->data = (byte *) malloc(sizeof(byte) * GAP_BUFFER_INIT_CAPACITY * element_size);
+    buffer->gap_start = 0;
+    buffer->gap_end = GAP_BUFFER_INIT_CAPACITY;
+    buffer->capacity = GAP_BUFFER_INIT_CAPACITY;
+    buffer->element_size = element_size;
+}
+
+/**
+ * @brief Initialize the gap buffer by taking over the storage of the specified vector.
+ *
+ * The vector's unused capacity becomes the gap and the cursor is placed at the end,
+ * so no element is copied. The vector is left empty without storage.
+ *
+ * @param buffer The gap buffer to be initialized.
+ * @param vector The vector whose storage will be taken.
+ */
+void gap_buffer_from_vector(gap_buffer* buffer, vector* vector) {
+    assert(buffer != NULL && vector != NULL && vector->data != NULL);
+
+    buffer->data = vector->data;
+    buffer->gap_start = vector->size;
+    buffer->gap_end = vector->capacity;
+    buffer->capacity = vector->capacity;
+    buffer->element_size = vector->element_size;
+
+    vector->data = NULL;
+    vector->size = 0;
+    vector->capacity = 0;
+}
+
+/**
+ * @brief Copies the element at the specified index from the gap buffer to a pre-allocated memory block.
+ *
+ * @param buffer The gap buffer from which the element will be retrieved.
+ * @param index The index of the wanted element.
+ * @param dest A pointer to the memory location where the element will be stored.
+ */
+void gap_buffer_at(const gap_buffer* buffer, size_t index, void* dest) {
+    assert(buffer != NULL && buffer->data != NULL && index < gap_buffer_size(buffer) && dest != NULL);
+
+    memcpy(dest, gap_buffer_slot(buffer, index), sizeof(byte) * buffer->element_size);
+}
+
+/**
+ * @brief Gets the position of the cursor, which is the index of the next insertion.
+ *
+ * @param buffer The gap buffer whose cursor will be returned.
+ *
+ * @return The position of the cursor.
+ */
+size_t gap_buffer_cursor(const gap_buffer* buffer) {
+    assert(buffer != NULL);
+
+    return buffer->gap_start;
+}
+
+/**
+ * @brief Moves the cursor to the specified index, the cost is the distance moved.
+ *
+ * @param buffer The gap buffer whose cursor will be moved.
+ * @param index The new position of the cursor.
+ */
+void gap_buffer_move_cursor(gap_buffer* buffer, size_t index) {
+    assert(buffer != NULL && buffer->data != NULL && index <= gap_buffer_size(buffer));
+
+    if (index < buffer->gap_start) {
+        size_t count = buffer->gap_start - index;
+        memmove(buffer->data + (buffer->gap_end - count) * buffer->element_size,
+                buffer->data + index * buffer->element_size,
+                sizeof(byte) * count * buffer->element_size);
+        buffer->gap_start -= count;
+        buffer->gap_end -= count;
+    }
+    else if (index > buffer->gap_start) {
+        size_t count = index - buffer->gap_start;
+        memmove(buffer->data + buffer->gap_start * buffer->element_size,
+                buffer->data + buffer->gap_end * buffer->element_size,
+                sizeof(byte) * count * buffer->element_size);
+        buffer->gap_start += count;
+        buffer->gap_end += count;
+    }
+}
+
+/**
+ * @brief Insert the specified value at the cursor and advance the cursor past it.
+ *
+ * @param buffer A pointer to the gap buffer to add to.
+ * @param val The value to be added to the gap buffer.
+ */
+void gap_buffer_insert(gap_buffer* buffer, const void* val) {
+    assert(buffer != NULL && buffer->data != NULL && val != NULL);
+
+    gap_buffer_grow(buffer);
+    memcpy(buffer->data + buffer->gap_start * buffer->element_size,
+           val, sizeof(byte) * buffer->element_size);
+    buffer->gap_start++;
+}
+
+/**
+ * @brief Insert the specified value into the specified index of the gap buffer.
+ *
+ * @param buffer A pointer to the gap buffer to add to.
+ * @param val The value to be added to the gap buffer.
+ * @param index The index at which the value should be inserted.
+ */
+void gap_buffer_insert_at(gap_buffer* buffer, const void* val, size_t index) {
+    assert(buffer != NULL && buffer->data != NULL && val != NULL && index <= gap_buffer_size(buffer));
+
+    gap_buffer_move_cursor(buffer, index);
+    gap_buffer_insert(buffer, val);
+}
+
+/**
+ * @brief Remove the element right before the cursor.
+ *
+ * @param buffer A pointer to the gap buffer to remove from.
+ */
+void gap_buffer_erase_before(gap_buffer* buffer) {
+    assert(buffer != NULL && buffer->gap_start > 0);
+
+    buffer->gap_start--;
+}
+
+/**
+ * @brief Remove the element right after the cursor.
+ *
+ * @param buffer A pointer to the gap buffer to remove from.
+ */
+void gap_buffer_erase_after(gap_buffer* buffer) {
+    assert(buffer != NULL && buffer->gap_end < buffer->capacity);
+
+    buffer->gap_end++;
+}
+
+/**
+ * @brief Remove the element at the specified index from the gap buffer.
+ *
+ * @param buffer A pointer to the gap buffer to remove from.
+ * @param index The index of the value wanted to be removed from the gap buffer.
+ */
+void gap_buffer_remove_at(gap_buffer* buffer, size_t index) {
+    assert(buffer != NULL && buffer->data != NULL && index < gap_buffer_size(buffer));
+
+    gap_buffer_move_cursor(buffer, index);
+    gap_buffer_erase_after(buffer);
+}
+
+/**
+ * @brief Remove all the gap buffer elements.
+ *
+ * @param buffer A pointer to the gap buffer to remove from.
+ */
+void gap_buffer_clear(gap_buffer* buffer) {
+    assert(buffer != NULL);
+
+    buffer->gap_start = 0;
+    buffer->gap_end = buffer->capacity;
+}
+
+/**
+ * @brief Frees the memory allocated for the gap buffer data.
+ *
+ * @param buffer A pointer to the gap buffer to free from.
+ */
+void gap_buffer_destroy(gap_buffer* buffer) {
+    assert(buffer != NULL);
+
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->gap_start = 0;
+    buffer->gap_end = 0;
+    buffer->capacity = 0;
+}
+
+/**
+ * @brief Gets the number of elements in the specified gap buffer.
+ *
+ * @param buffer The gap buffer whose size will be returned.
+ *
+ * @return The size of the specified gap buffer.
+ */
+size_t gap_buffer_size(const gap_buffer* buffer) {
+    assert(buffer != NULL);
+
+    return buffer->capacity - (buffer->gap_end - buffer->gap_start);
+}
+
+/**
+ * @brief Checks whether the gap buffer is empty or not.
+ *
+ * @param buffer The gap buffer to be checked.
+ *
+ * @return Whether or not the gap buffer is empty.
+ */
+bool gap_buffer_is_empty(const gap_buffer* buffer) {
+    assert(buffer != NULL);
+
+    return gap_buffer_size(buffer) == 0;
+}
+
+/**
+ * @brief Reserves the required space for the specified gap buffer, the extra space joins the gap.
+ *
+ * @param buffer The gap buffer for which we will reserve a space.
+ * @param new_capacity The new capacity to reserve for the gap buffer.
+ */
+void gap_buffer_reserve(gap_buffer* buffer, size_t new_capacity) {
+    assert(buffer != NULL && new_capacity >= gap_buffer_size(buffer));
+
+    size_t tail = buffer->capacity - buffer->gap_end;
+    if (new_capacity > buffer->capacity) {
+        buffer->data = realloc(buffer->data, sizeof(byte) * new_capacity * buffer->element_size);
+        memmove(buffer->data + (new_capacity - tail) * buffer->element_size,
+                buffer->data + buffer->gap_end * buffer->element_size,
+                sizeof(byte) * tail * buffer->element_size);
+    }
+    else {
+        memmove(buffer->data + (new_capacity - tail) * buffer->element_size,
+                buffer->data + buffer->gap_end * buffer->element_size,
+                sizeof(byte) * tail * buffer->element_size);
+        buffer->data = realloc(buffer->data, sizeof(byte) * new_capacity * buffer->element_size);
+    }
+    buffer->gap_end = new_capacity - tail;
+    buffer->capacity = new_capacity;
+}
+
+/**
+ * @brief Moves the gap buffer elements into the specified vector.
+ *
+ * The gap is moved to the end first so the storage is handed over without a copy.
+ * The gap buffer is left empty without storage.
+ *
+ * @param buffer The gap buffer whose elements will be moved.
+ * @param vector The vector to receive the elements, any storage it owns is freed.
+ */
+void gap_buffer_to_vector(gap_buffer* buffer, vector* vector) {
+    assert(buffer != NULL && buffer->data != NULL && vector != NULL);
+
+    gap_buffer_move_cursor(buffer, gap_buffer_size(buffer));
+    free(vector->data);
+    vector->data = buffer->data;
+    vector->size = buffer->gap_start;
+    vector->capacity = buffer->capacity;
+    vector->element_size = buffer->element_size;
+
+    buffer->data = NULL;
+    buffer->gap_start = 0;
+    buffer->gap_end = 0;
+    buffer->capacity = 0;
+}
+
+/**
+ * @brief Copies the gap buffer elements to the specified array.
+ *
+ * @param buffer The gap buffer whose elements will be copied to the specified array.
+ * @param array The array where the gap buffer's elements will be copied.
+ */
+void gap_buffer_copy_to_array(const gap_buffer* buffer, void* array) {
+    assert(buffer != NULL && array != NULL);
+
+    byte* dest = (byte *) array;
+    memcpy(dest, buffer->data, sizeof(byte) * buffer->gap_start * buffer->element_size);
+    memcpy(dest + buffer->gap_start * buffer->element_size,
+           buffer->data + buffer->gap_end * buffer->element_size,
+           sizeof(byte) * (buffer->capacity - buffer->gap_end) * buffer->element_size);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file     gap_buffer.h
+ *
+ * @brief    The Implementation of the Gap Buffer.
+ * @author   Hassan Tarek
+ */
+
+#ifndef GAP_BUFFER_H
+#define GAP_BUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+
+/* Struct type declaration */
+struct gap_buffer;
+
+/* Typedefs */
+typedef struct gap_buffer gap_buffer;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the gap buffer.
+ *
+ * The elements are stored in [0, gap_start) and [gap_end, capacity),
+ * the gap between them is the cursor where the insertions happen.
+ */
+struct gap_buffer {
+    byte* data;
+    size_t gap_start;
+    size_t gap_end;
+    size_t capacity;
+    size_t element_size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void gap_buffer_init(gap_buffer* buffer, size_t element_size);
+void gap_buffer_from_vector(gap_buffer* buffer, vector* vector);
+
+/* Accessing */
+void gap_buffer_at(const gap_buffer* buffer, size_t index, void* dest);
+size_t gap_buffer_cursor(const gap_buffer* buffer);
+
+/* Cursor */
+void gap_buffer_move_cursor(gap_buffer* buffer, size_t index);
+
+/* Insertion */
+void gap_buffer_insert(gap_buffer* buffer, const void* val);
+void gap_buffer_insert_at(gap_buffer* buffer, const void* val, size_t index);
+
+/* Removal */
+void gap_buffer_erase_before(gap_buffer* buffer);
+void gap_buffer_erase_after(gap_buffer* buffer);
+void gap_buffer_remove_at(gap_buffer* buffer, size_t index);
+void gap_buffer_clear(gap_buffer* buffer);
+void gap_buffer_destroy(gap_buffer* buffer);
+
+/* Utility */
+size_t gap_buffer_size(const gap_buffer* buffer);
+bool gap_buffer_is_empty(const gap_buffer* buffer);
+void gap_buffer_reserve(gap_buffer* buffer, size_t new_capacity);
+void gap_buffer_to_vector(gap_buffer* buffer, vector* vector);
+void gap_buffer_copy_to_array(const gap_buffer* buffer, void* array);
+
+
+/* M A C R O S */
+
+#define GAP_BUFFER_INIT_CAPACITY 100
+
+#define gap_buffer_for_each(index, buffer_ptr)     \
+    for (size_t index = 0;                         \
+         index < gap_buffer_size(buffer_ptr);      \
+         ++index)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GAP_BUFFER_H */
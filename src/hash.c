@@ -0,0 +1,47 @@
+#include "hash.h"
+
+/**
+ * @brief Hashes the specified bytes into 64 bits, eight bytes at a time.
+ *        It is fast and well mixed but not meant to resist attacks.
+ *
+ * @param data The bytes to be hashed.
+ * @param size The number of bytes.
+ * @param seed The seed selecting the hash function.
+ *
+ * @return The hash of the bytes.
+ */
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+    assert(data != NULL || size == 0);
+
+    const uint8_t* bytes = (const uint8_t *) data;
+    uint64_t hash = seed ^ (size * 0x9e3779b97f4a7c15ULL);
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof(uint64_t));
+        hash = (hash ^ hash_mix(word)) * 0x9e3779b97f4a7c15ULL;
+        bytes += 8;
+        size -= 8;
+    }
+    if (size > 0) {
+        uint64_t word = 0;
+        memcpy(&word, bytes, size);
+        hash = (hash ^ hash_mix(word)) * 0x9e3779b97f4a7c15ULL;
+    }
+    return hash_mix(hash);
+}
+
+/**
+ * @brief Mixes the bits of the specified value so every input bit affects every output bit.
+ *
+ * @param val The value to be mixed.
+ *
+ * @return The mixed value.
+ */
+uint64_t hash_mix(uint64_t val) {
+    val ^= val >> 30;
+    val *= 0xbf58476d1ce4e5b9ULL;
+    val ^= val >> 27;
+    val *= 0x94d049bb133111ebULL;
+    val ^= val >> 31;
+    return val;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file     hash.h
+ *
+ * @brief    The Implementation of the Byte Hashing Functions.
+ * @author   Hassan Tarek
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Hashing */
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed);
+uint64_t hash_mix(uint64_t val);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* HASH_H */
@@ -0,0 +1,228 @@
+#include "intrusive_list.h"
+
+/**
+ * @brief Links the hook between two adjacent hooks.
+ *
+ * @param hook The hook to be linked.
+ * @param prev The hook which will precede it.
+ * @param next The hook which will follow it.
+ */
+static void intrusive_list_link(list_hook* hook, list_hook* prev, list_hook* next) {
+    hook->prev = prev;
+    hook->next = next;
+    prev->next = hook;
+    next->prev = hook;
+}
+
+/**
+ * @brief Initialize the intrusive list.
+ *
+ * @param list The list to be initialized.
+ */
+void intrusive_list_init(intrusive_list* list) {
+    assert(list != NULL);
+
+    list->sentinel.next = &list->sentinel;
+    list->sentinel.prev = &list->sentinel;
+    list->size = 0;
+}
+
+/**
+ * @brief Initialize the hook as not linked into any list.
+ *
+ * @param hook The hook to be initialized.
+ */
+void list_hook_init(list_hook* hook) {
+    assert(hook != NULL);
+
+    hook->next = NULL;
+    hook->prev = NULL;
+}
+
+/**
+ * @brief Retrieves the last hook of the specified list.
+ *
+ * @param list The list whose last hook wanted to be retrieved.
+ *
+ * @return The last hook or NULL if the list is empty.
+ */
+list_hook* intrusive_list_back(const intrusive_list* list) {
+    assert(list != NULL);
+
+    return list->size > 0 ? list->sentinel.prev : NULL;
+}
+
+/**
+ * @brief Retrieves the first hook of the specified list.
+ *
+ * @param list The list whose first hook wanted to be retrieved.
+ *
+ * @return The first hook or NULL if the list is empty.
+ */
+list_hook* intrusive_list_front(const intrusive_list* list) {
+    assert(list != NULL);
+
+    return list->size > 0 ? list->sentinel.next : NULL;
+}
+
+/**
+ * @brief Checks whether or not the hook is linked into a list.
+ *
+ * @param hook The hook initialized by list_hook_init.
+ *
+ * @return Whether or not the hook is linked.
+ */
+bool list_hook_is_linked(const list_hook* hook) {
+    assert(hook != NULL);
+
+    return hook->next != NULL;
+}
+
+/**
+ * @brief Links the specified hook at the end of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param hook The unlinked hook to be added.
+ */
+void intrusive_list_push_back(intrusive_list* list, list_hook* hook) {
+    assert(list != NULL && hook != NULL);
+
+    intrusive_list_link(hook, list->sentinel.prev, &list->sentinel);
+    list->size++;
+}
+
+/**
+ * @brief Links the specified hook at the front of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param hook The unlinked hook to be added.
+ */
+void intrusive_list_push_front(intrusive_list* list, list_hook* hook) {
+    assert(list != NULL && hook != NULL);
+
+    intrusive_list_link(hook, &list->sentinel, list->sentinel.next);
+    list->size++;
+}
+
+/**
+ * @brief Links the specified hook before the position hook.
+ *
+ * @param list A pointer to a list to add to.
+ * @param position A hook of the list, or its sentinel to add at the end.
+ * @param hook The unlinked hook to be added.
+ */
+void intrusive_list_insert_before(intrusive_list* list, list_hook* position, list_hook* hook) {
+    assert(list != NULL && position != NULL && hook != NULL);
+
+    intrusive_list_link(hook, position->prev, position);
+    list->size++;
+}
+
+/**
+ * @brief Moves all the hooks of other before the position hook in constant time,
+ *        other is left empty.
+ *
+ * @param list A pointer to a list to add to.
+ * @param position A hook of the list, or its sentinel to add at the end.
+ * @param other The list whose hooks will be moved, it must be a different list.
+ */
+void intrusive_list_splice(intrusive_list* list, list_hook* position, intrusive_list* other) {
+    assert(list != NULL && position != NULL && other != NULL && list != other);
+
+    if (other->size == 0) {
+        return;
+    }
+    list_hook* first = other->sentinel.next;
+    list_hook* last = other->sentinel.prev;
+    first->prev = position->prev;
+    position->prev->next = first;
+    last->next = position;
+    position->prev = last;
+    list->size += other->size;
+    intrusive_list_init(other);
+}
+
+/**
+ * @brief Unlinks the last hook from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ *
+ * @return The unlinked hook.
+ */
+list_hook* intrusive_list_pop_back(intrusive_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    list_hook* hook = list->sentinel.prev;
+    intrusive_list_unlink(list, hook);
+    return hook;
+}
+
+/**
+ * @brief Unlinks the first hook from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ *
+ * @return The unlinked hook.
+ */
+list_hook* intrusive_list_pop_front(intrusive_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    list_hook* hook = list->sentinel.next;
+    intrusive_list_unlink(list, hook);
+    return hook;
+}
+
+/**
+ * @brief Unlinks the specified hook from the list in constant time.
+ *
+ * @param list A pointer to the list holding the hook.
+ * @param hook The hook to be unlinked.
+ */
+void intrusive_list_unlink(intrusive_list* list, list_hook* hook) {
+    assert(list != NULL && hook != NULL && hook != &list->sentinel && list_hook_is_linked(hook));
+
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    list_hook_init(hook);
+    list->size--;
+}
+
+/**
+ * @brief Unlinks all the hooks from the list, the objects themselves are untouched.
+ *
+ * @param list A pointer to a list to remove from.
+ */
+void intrusive_list_clear(intrusive_list* list) {
+    assert(list != NULL);
+
+    intrusive_list_for_each_safe(hook, list) {
+        list_hook_init(hook);
+    }
+    intrusive_list_init(list);
+}
+
+/**
+ * @brief Gets the size of the specified list.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The number of linked hooks.
+ */
+size_t intrusive_list_size(const intrusive_list* list) {
+    assert(list != NULL);
+
+    return list->size;
+}
+
+/**
+ * @brief Checks whether or not the specified list is empty.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool intrusive_list_is_empty(const intrusive_list* list) {
+    assert(list != NULL);
+
+    return list->size == 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file     intrusive_list.h
+ *
+ * @brief    The Implementation of the Intrusive Doubly Linked List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct list_hook;
+struct intrusive_list;
+
+/* Typedefs */
+typedef struct list_hook list_hook;
+typedef struct intrusive_list intrusive_list;
+
+/**
+ * Define the struct represent the hook embedded in the caller's struct,
+ * one hook per list the object can be linked into at the same time.
+ */
+struct list_hook {
+    list_hook* next;
+    list_hook* prev;
+};
+
+/**
+ * Define the struct represent the intrusive doubly linked list.
+ *
+ * The list only links the hooks of objects owned by the caller, so no
+ * operation allocates or copies. The hooks form a ring through the sentinel.
+ */
+struct intrusive_list {
+    list_hook sentinel;
+    size_t size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void intrusive_list_init(intrusive_list* list);
+void list_hook_init(list_hook* hook);
+
+/* Accessing */
+list_hook* intrusive_list_back(const intrusive_list* list);
+list_hook* intrusive_list_front(const intrusive_list* list);
+bool list_hook_is_linked(const list_hook* hook);
+
+/* Insertion */
+void intrusive_list_push_back(intrusive_list* list, list_hook* hook);
+void intrusive_list_push_front(intrusive_list* list, list_hook* hook);
+void intrusive_list_insert_before(intrusive_list* list, list_hook* position, list_hook* hook);
+void intrusive_list_splice(intrusive_list* list, list_hook* position, intrusive_list* other);
+
+/* Removal */
+list_hook* intrusive_list_pop_back(intrusive_list* list);
+list_hook* intrusive_list_pop_front(intrusive_list* list);
+void intrusive_list_unlink(intrusive_list* list, list_hook* hook);
+void intrusive_list_clear(intrusive_list* list);
+
+/* Utility */
+size_t intrusive_list_size(const intrusive_list* list);
+bool intrusive_list_is_empty(const intrusive_list* list);
+
+
+/* M A C R O S */
+
+#define intrusive_list_entry(hook_ptr, type, member) \
+    ((type *) ((char *) (hook_ptr) - offsetof(type, member)))
+
+#define intrusive_list_for_each(hook_ptr, list_ptr)             \
+    for (list_hook* hook_ptr = (list_ptr)->sentinel.next;       \
+         hook_ptr != &(list_ptr)->sentinel;                     \
+         hook_ptr = hook_ptr->next)
+
+#define intrusive_list_for_each_safe(hook_ptr, list_ptr)                                  \
+    for (list_hook* hook_ptr = (list_ptr)->sentinel.next, * hook_ptr##_next = hook_ptr->next; \
+         hook_ptr != &(list_ptr)->sentinel;                                               \
+         hook_ptr = hook_ptr##_next, hook_ptr##_next = hook_ptr->next)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INTRUSIVE_LIST_H */
@@ -1,40 +1,319 @@
 #include "list.h"
 
 /**
- * @brief Create a new node.
+ * @brief Gets the distance in bytes between two nodes of the same slab.
  *
+ * @param list The list owning the nodes.
+ *
+ * @return The size of a node with its value, rounded up to keep the next node aligned.
+ */
+static size_t list_node_size(const list* list) {
+    size_t alignment = _Alignof(max_align_t);
+    return sizeof(node) + (list->element_size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Gets the size of a slab header, rounded up to keep the first node aligned.
+ */
+static size_t list_slab_header_size() {
+    size_t alignment = _Alignof(max_align_t);
+    return (sizeof(list_slab) + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Adds the specified node to the front of the free nodes of the list.
+ */
+static void list_push_free_node(list* list, node* node_ptr) {
+    node_ptr->prev = NULL;
+    node_ptr->next = list->free_nodes;
+    if (list->free_nodes != NULL) {
+        list->free_nodes->prev = node_ptr;
+    }
+    list->free_nodes = node_ptr;
+}
+
+/**
+ * @brief Allocates a new slab of nodes, the unused nodes of the current slab are cached first.
+ *
+ * @param list The list owning the slab.
+ * @param count The number of nodes in the slab.
+ */
+static void list_add_slab(list* list, size_t count) {
+    size_t node_size = list_node_size(list);
+    while (list->slab_cursor != list->slab_end) {
+        node* node_ptr = (node *) list->slab_cursor;
+        node_ptr->slab = list->slabs;
+        list_push_free_node(list, node_ptr);
+        list->slab_cursor += node_size;
+    }
+    list_slab* slab = (list_slab *) malloc(list_slab_header_size() + sizeof(byte) * count * node_size);
+    slab->owner = list;
+    slab->next = list->slabs;
+    slab->prev = NULL;
+    slab->count = count;
+    slab->live = 0;
+    if (list->slabs != NULL) {
+        list->slabs->prev = slab;
+    }
+    list->slabs = slab;
+    list->slabs_size++;
+    list->slab_cursor = (byte *) slab + list_slab_header_size();
+    list->slab_end = list->slab_cursor + count * node_size;
+    list->capacity += count;
+}
+
+/**
+ * @brief Takes the next node out of the current slab, which must have one left.
+ *
+ * @param list The list owning the slab.
+ *
+ * @return The carved node, counted as live.
+ */
+static node* list_carve_node(list* list) {
+    node* node_ptr = (node *) list->slab_cursor;
+    list->slab_cursor += list_node_size(list);
+    node_ptr->slab = list->slabs;
+    list->slabs->live++;
+    return node_ptr;
+}
+
+/**
+ * @brief Frees a slab of the list whose nodes are all free, unlinking them from the free nodes.
+ *
+ * @param list The list owning the slab.
+ * @param slab The slab to be freed, it must not be the one the nodes are carved from.
+ */
+static void list_free_slab(list* list, list_slab* slab) {
+    size_t node_size = list_node_size(list);
+    byte* cur = (byte *) slab + list_slab_header_size();
+    for (size_t i = 0; i < slab->count; i++, cur += node_size) {
+        node* node_ptr = (node *) cur;
+        if (node_ptr->prev != NULL)
+            node_ptr->prev->next = node_ptr->next;
+        else
+            list->free_nodes = node_ptr->next;
+        if (node_ptr->next != NULL)
+            node_ptr->next->prev = node_ptr->prev;
+    }
+    if (slab->prev != NULL)
+        slab->prev->next = slab->next;
+    else
+        list->slabs = slab->next;
+    if (slab->next != NULL)
+        slab->next->prev = slab->prev;
+    list->slabs_size--;
+    list->capacity -= slab->count;
+    free(slab);
+}
+
+/**
+ * @brief Returns a node removed from the specified list to its slab. The node becomes a
+ *        free node of the slab owner, or frees the slab with it when the owner was cleared.
+ *
+ * @param list The list the node was removed from, its own slabs are being dropped when
+ *             it is the owner and the node is not to be reused.
+ * @param node_ptr The node to be released.
+ * @param reuse Whether or not a node of the list's own slabs is kept for reuse.
+ */
+static void list_release_node(list* list, node* node_ptr, bool reuse) {
+    list_slab* slab = node_ptr->slab;
+    slab->live--;
+    if (slab->owner == NULL) {
+        if (slab->live == 0) {
+            free(slab);
+        }
+    }
+    else if (reuse || slab->owner != list) {
+        list_push_free_node(slab->owner, node_ptr);
+        if (slab->live == 0 && slab != slab->owner->slabs) {
+            list_free_slab(slab->owner, slab);
+        }
+    }
+}
+
+/**
+ * @brief Releases the nodes of a chain and then the slabs of the list, as when clearing it.
+ *        A slab whose nodes are all released is freed, the others are left to their last node.
+ *
+ * @param list The list whose nodes and slabs are dropped.
+ * @param first The first node of the chain, terminated by NULL.
+ * @param slabs The slabs owned by the list.
+ */
+static void list_drop(list* list, node* first, list_slab* slabs) {
+    while (first != NULL) {
+        node* next = first->next;
+        list_release_node(list, first, false);
+        first = next;
+    }
+    while (slabs != NULL) {
+        list_slab* next = slabs->next;
+        if (slabs->live == 0)
+            free(slabs);
+        else
+            slabs->owner = NULL;
+        slabs = next;
+    }
+}
+
+/**
+ * @brief Moves a chain of nodes from src before the position node of dest by relinking.
+ *
+ * @param dest The list to move to.
+ * @param position A node of dest, or NULL to move to the end.
+ * @param src The list to move from, it may be dest itself.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @param count The number of nodes in the chain.
+ */
+static void list_move_range(list* dest, node* position, list* src, node* first, node* last, size_t count) {
+    node* prev = first->prev;
+    node* next = last->next;
+    if (prev != NULL)
+        prev->next = next;
+    else
+        src->head = next;
+    if (next != NULL)
+        next->prev = prev;
+    else
+        src->tail = prev;
+    src->size -= count;
+
+    node* before = position != NULL ? position->prev : dest->tail;
+    first->prev = before;
+    last->next = position;
+    if (before != NULL)
+        before->next = first;
+    else
+        dest->head = first;
+    if (position != NULL)
+        position->prev = last;
+    else
+        dest->tail = last;
+    dest->size += count;
+}
+
+/**
+ * @brief Create a new node, taken from the free nodes or the current slab.
+ *
+ * @param list The list owning the node.
  * @param val The value of the node.
- * @param size The size in bytes of the specified value.
  * @param next A pointer to the next node.
  * @param prev A pointer to the previous node.
  *
  * @return A pointer to the newly created node.
  */
-static node* list_create_node(const void* val, size_t size, node* next, node* prev) {
+static node* list_create_node(list* list, const void* val, node* next, node* prev) {
     assert(val != NULL);
 
-    node* node_ptr = (node *) malloc(sizeof(node));
-    node_ptr->val = (byte *) malloc(size);
-    memcpy(node_ptr->val, val, size);
+    node* node_ptr = list->free_nodes;
+    if (node_ptr != NULL) {
+        list->free_nodes = node_ptr->next;
+        if (list->free_nodes != NULL) {
+            list->free_nodes->prev = NULL;
+        }
+        node_ptr->slab->live++;
+    }
+    else {
+        if (list->slab_cursor == list->slab_end) {
+            size_t count = list->capacity > LIST_SLAB_MIN_NODES ? list->capacity : LIST_SLAB_MIN_NODES;
+            list_add_slab(list, count < LIST_SLAB_MAX_NODES ? count : LIST_SLAB_MAX_NODES);
+        }
+        node_ptr = list_carve_node(list);
+    }
+    memcpy(node_ptr->val, val, list->element_size);
     node_ptr->next = next;
     node_ptr->prev = prev;
     return node_ptr;
 }
 
 /**
- * @brief Deallocate the memory of the specified node.
+ * @brief Returns the specified node, removed from the list, to the free nodes of its slab owner.
  *
+ * @param list The list the node was removed from.
  * @param node The node wanted to be freed.
  */
-static void list_free_node(node** node) {
+static void list_free_node(list* list, node** node) {
     assert(node != NULL && *node != NULL);
 
-    if ((*node)->val != NULL) {
-        free((*node)->val);
-        (*node)->val = NULL;
-    }
-    free(*node);
+    list_release_node(list, *node, true);
     *node = NULL;
+    list->churn++;
+}
+
+/**
+ * @brief Finds the node at the specified index by walking from the closer end of the list.
+ *
+ * @param list The list to be searched.
+ * @param index The index of the node, less than the size.
+ *
+ * @return The node at the specified index.
+ */
+static node* list_node_at(const list* list, size_t index) {
+    node* cur;
+    if (index < list->size / 2) {
+        cur = list->head;
+        for (size_t offset = 0; offset < index; offset++) {
+            cur = cur->next;
+        }
+    }
+    else {
+        cur = list->tail;
+        for (size_t offset = list->size - 1; offset > index; offset--) {
+            cur = cur->prev;
+        }
+    }
+    return cur;
+}
+
+/**
+ * @brief Cuts the longest non-decreasing run off the front of a chain of nodes.
+ *
+ * @param first The first node of the chain.
+ * @param compare The compare function ordering the values.
+ *
+ * @return The first node after the run, which is now terminated by NULL.
+ */
+static node* list_cut_run(node* first, int (* compare)(const void* lhs, const void* rhs)) {
+    node* last = first;
+    while (last->next != NULL && compare(last->val, last->next->val) <= 0) {
+        last = last->next;
+    }
+    node* rest = last->next;
+    last->next = NULL;
+    return rest;
+}
+
+/**
+ * @brief Merges two sorted runs by relinking their nodes, ties are taken from the first run.
+ *
+ * @param first The first run, terminated by NULL.
+ * @param second The second run, terminated by NULL, may be NULL.
+ * @param compare The compare function ordering the values.
+ * @param tail Receives the last node of the merged run.
+ *
+ * @return The first node of the merged run.
+ */
+static node* list_merge_runs(node* first, node* second, int (* compare)(const void* lhs, const void* rhs),
+                             node** tail) {
+    node head;
+    node* last = &head;
+    while (first != NULL && second != NULL) {
+        if (compare(first->val, second->val) <= 0) {
+            last->next = first;
+            first = first->next;
+        }
+        else {
+            last->next = second;
+            second = second->next;
+        }
+        last = last->next;
+    }
+    last->next = first != NULL ? first : second;
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    *tail = last;
+    return head.next;
 }
 
 /**
@@ -50,6 +329,28 @@ void list_init(list* list, size_t element_size) {
     list->tail = NULL;
     list->size = 0;
     list->element_size = element_size;
+    list->capacity = 0;
+    list->free_nodes = NULL;
+    list->slab_cursor = NULL;
+    list->slab_end = NULL;
+    list->slabs = NULL;
+    list->slabs_size = 0;
+    list->churn = 0;
+    list->defragment_threshold = 0;
+}
+
+/**
+ * @brief Replaces the elements of the initialized list with the elements of the array.
+ *
+ * @param list The list to be filled.
+ * @param array A pointer to the array whose values will be copied.
+ * @param array_size The number of elements in the array.
+ */
+void list_from_array(list* list, const void* array, size_t array_size) {
+    assert(list != NULL && (array != NULL || array_size == 0));
+
+    list_clear(list);
+    list_append_array(list, array, array_size);
 }
 
 /**
@@ -89,14 +390,7 @@ node* list_front(const list* list) {
 node* list_at(const list* list, size_t index) {
     assert(list != NULL && index < list->size);
 
-    size_t offset = 0;
-    list_for_each(node, list) {
-        if(offset == index) {
-            return node;
-        }
-        offset++;
-    }
-    return NULL;
+    return list_node_at(list, index);
 }
 
 /**
@@ -130,7 +424,7 @@ int list_index_of(const list* list, const void* val) {
 void list_push_back(list* list, const void* val) {
     assert(list != NULL && val != NULL);
 
-    node* node_ptr = list_create_node(val, list->element_size, NULL, list->tail);
+    node* node_ptr = list_create_node(list, val, NULL, list->tail);
     if(list->size == 0)
         list->head = node_ptr;
     else
@@ -148,7 +442,7 @@ void list_push_back(list* list, const void* val) {
 void list_push_front(list* list, const void* val) {
     assert(list != NULL && val != NULL);
 
-    node* node_ptr = list_create_node(val, list->element_size, list->head, NULL);
+    node* node_ptr = list_create_node(list, val, list->head, NULL);
     if(list->size == 0)
         list->tail = node_ptr;
     else
@@ -167,24 +461,86 @@ void list_push_front(list* list, const void* val) {
 void list_insert_at(list* list, const void* val, size_t index) {
     assert(list != NULL && val != NULL && index <= list->size);
 
-    if (list->size == 0) {
+    list_insert_before(list, index < list->size ? list_node_at(list, index) : NULL, val);
+}
+
+/**
+ * @brief Insert a new node with the specified value before the specified node in constant time.
+ *
+ * @param list A pointer to a list to add to.
+ * @param position A node of the list, or NULL to insert at the end.
+ * @param val The value of the node to be added to the list.
+ *
+ * @return The newly inserted node.
+ */
+node* list_insert_before(list* list, node* position, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    if (position == NULL) {
+        list_push_back(list, val);
+        return list->tail;
+    }
+    if (position == list->head) {
         list_push_front(list, val);
+        return list->head;
     }
-    else if(index == list->size) {
-        list_push_back(list, val);
+    node* node_ptr = list_create_node(list, val, position, position->prev);
+    position->prev->next = node_ptr;
+    position->prev = node_ptr;
+    list->size++;
+    return node_ptr;
+}
+
+/**
+ * @brief Insert a new node with the specified value after the specified node in constant time.
+ *
+ * @param list A pointer to a list to add to.
+ * @param position A node of the list, or NULL to insert at the front.
+ * @param val The value of the node to be added to the list.
+ *
+ * @return The newly inserted node.
+ */
+node* list_insert_after(list* list, node* position, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    return list_insert_before(list, position != NULL ? position->next : list->head, val);
+}
+
+/**
+ * @brief Appends the elements of the array to the end of the list. The nodes are carved
+ *        consecutively out of one slab and linked in a single pass, each of them can
+ *        still be removed on its own.
+ *
+ * @param list A pointer to the list to add to.
+ * @param array A pointer to the array whose values will be copied.
+ * @param array_size The number of elements in the array.
+ */
+void list_append_array(list* list, const void* array, size_t array_size) {
+    assert(list != NULL && (array != NULL || array_size == 0));
+
+    if (array_size == 0) {
+        return;
     }
-    else {
-        size_t offset = 0;
-        node* cur = list->head;
-        while(offset < index) {
-            cur = cur->next;
-            offset++;
-        }
-        node* node_ptr = list_create_node(val, list->element_size, cur, cur->prev);
-        cur->prev->next = node_ptr;
-        cur->prev = node_ptr;
-        list->size++;
+    size_t node_size = list_node_size(list);
+    if ((size_t) (list->slab_end - list->slab_cursor) < array_size * node_size) {
+        list_add_slab(list, array_size);
+    }
+    const byte* val = (const byte *) array;
+    node* prev = list->tail;
+    for (size_t i = 0; i < array_size; i++) {
+        node* node_ptr = list_carve_node(list);
+        memcpy(node_ptr->val, val, list->element_size);
+        val += list->element_size;
+        node_ptr->prev = prev;
+        if (prev != NULL)
+            prev->next = node_ptr;
+        else
+            list->head = node_ptr;
+        prev = node_ptr;
     }
+    prev->next = NULL;
+    list->tail = prev;
+    list->size += array_size;
 }
 
 /**
@@ -204,7 +560,7 @@ void list_pop_back(list* list) {
         list->head = NULL;
         list->tail = NULL;
     }
-    list_free_node(&temp);
+    list_free_node(list, &temp);
     list->size--;
 }
 
@@ -225,7 +581,7 @@ void list_pop_front(list* list) {
         list->head = NULL;
         list->tail = NULL;
     }
-    list_free_node(&temp);
+    list_free_node(list, &temp);
     list->size--;
 }
 
@@ -238,26 +594,34 @@ void list_pop_front(list* list) {
 void list_remove_at(list* list, size_t index) {
     assert(list != NULL && index < list->size);
 
-    if(index == 0) {
+    list_erase(list, list_node_at(list, index));
+}
+
+/**
+ * @brief Remove the specified node from the list in constant time.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param position The node of the list wanted to be removed.
+ *
+ * @return The node that followed the removed node, NULL if it was the tail.
+ */
+node* list_erase(list* list, node* position) {
+    assert(list != NULL && position != NULL && list->size > 0);
+
+    node* next = position->next;
+    if (position == list->head) {
         list_pop_front(list);
     }
-    else if(index == list->size - 1) {
+    else if (position == list->tail) {
         list_pop_back(list);
     }
     else {
-        size_t offset = 0;
-        node* cur = list->head;
-        while (offset < index) {
-            cur = cur->next;
-            offset++;
-        }
-        cur->prev->next = cur->next;
-        cur->next->prev = cur->prev;
-        cur->next = NULL;
-        cur->prev = NULL;
-        list_free_node(&cur);
+        position->prev->next = next;
+        next->prev = position->prev;
+        list_free_node(list, &position);
         list->size--;
     }
+    return next;
 }
 
 /**
@@ -288,7 +652,7 @@ void list_remove(list* list, const void* val) {
                 temp->prev->next = cur;
                 temp->next = NULL;
                 temp->prev = NULL;
-                list_free_node(&temp);
+                list_free_node(list, &temp);
                 list->size--;
             }
         }
@@ -299,16 +663,18 @@ void list_remove(list* list, const void* val) {
 }
 
 /**
- * @brief Remove all the nodes from the specified list.
+ * @brief Remove all the nodes from the specified list and free its slabs, except those
+ *        with nodes still linked in another list, which are freed with their last node.
  *
  * @param list A pointer to a list to remove from.
  */
 void list_clear(list* list) {
     assert(list != NULL);
 
-    while(list->size > 0) {
-        list_pop_back(list);
-    }
+    size_t defragment_threshold = list->defragment_threshold;
+    list_drop(list, list->head, list->slabs);
+    list_init(list, list->element_size);
+    list->defragment_threshold = defragment_threshold;
 }
 
 /**
@@ -324,6 +690,19 @@ size_t list_size(const list* list) {
     return list->size;
 }
 
+/**
+ * @brief Gets the number of nodes the specified list holds without allocating.
+ *
+ * @param list The list whose capacity will be returned.
+ *
+ * @return The number of allocated nodes, used or free.
+ */
+size_t list_capacity(const list* list) {
+    assert(list != NULL);
+
+    return list->capacity;
+}
+
 /**
  * @brief Checks whether or not the specified list is empty.
  *
@@ -337,6 +716,20 @@ bool list_is_empty(const list* list) {
     return list->size == 0;
 }
 
+/**
+ * @brief Reserves nodes for the specified list in a single slab.
+ *
+ * @param list The list for which we will reserve the nodes.
+ * @param new_capacity The number of nodes the list should hold without allocating.
+ */
+void list_reserve(list* list, size_t new_capacity) {
+    assert(list != NULL);
+
+    if (new_capacity > list->capacity) {
+        list_add_slab(list, new_capacity - list->capacity);
+    }
+}
+
 /**
  * @brief Merge a two specified lists into the dest list.
  *
@@ -355,6 +748,100 @@ void list_merge(const list* lhs, const list* rhs, list* dest) {
     }
 }
 
+/**
+ * @brief Moves the nodes from first to last of src before the position node of dest.
+ *        No node is allocated or copied, counting the moved nodes is the only walk,
+ *        and none is needed within one list.
+ *
+ * @param dest A pointer to the list to move to.
+ * @param position A node of dest, or NULL to move to the end.
+ * @param src A pointer to the list holding the range, it may be dest itself
+ *            as long as the position is outside the range.
+ * @param first The first node of the range.
+ * @param last The last node of the range, at or after first.
+ */
+void list_splice(list* dest, node* position, list* src, node* first, node* last) {
+    assert(dest != NULL && src != NULL && first != NULL && last != NULL);
+    assert(dest->element_size == src->element_size);
+
+    size_t count = 0;
+    if (dest != src) {
+        count = 1;
+        for (node* cur = first; cur != last; cur = cur->next) {
+            count++;
+        }
+    }
+    list_move_range(dest, position, src, first, last, count);
+}
+
+/**
+ * @brief Moves all the nodes of rhs to the end of lhs in constant time, rhs is left empty.
+ *
+ * @param lhs A pointer to the list to add to.
+ * @param rhs A pointer to the list whose nodes will be moved, it must be a different list.
+ */
+void list_concat(list* lhs, list* rhs) {
+    assert(lhs != NULL && rhs != NULL && lhs != rhs && lhs->element_size == rhs->element_size);
+
+    if (rhs->size == 0) {
+        return;
+    }
+    list_move_range(lhs, NULL, rhs, rhs->head, rhs->tail, rhs->size);
+}
+
+/**
+ * @brief Moves the nodes of src from the specified index to the end of dest,
+ *        walking to the index from the closer end of src.
+ *
+ * @param src A pointer to the list to split, it keeps the nodes before the index.
+ * @param index The index of the first node to be moved.
+ * @param dest A pointer to the list receiving the nodes, it must be a different list.
+ */
+void list_split_at(list* src, size_t index, list* dest) {
+    assert(src != NULL && dest != NULL && src != dest && index <= src->size);
+    assert(src->element_size == dest->element_size);
+
+    if (index == src->size) {
+        return;
+    }
+    list_move_range(dest, NULL, src, list_node_at(src, index), src->tail, src->size - index);
+}
+
+/**
+ * @brief Merges the sorted rhs into the sorted lhs by relinking the nodes,
+ *        equal values of lhs stay before those of rhs. Rhs is left empty.
+ *
+ * @param lhs A pointer to the sorted list to merge into.
+ * @param rhs A pointer to the sorted list to merge from, it must be a different list.
+ * @param compare The compare function both lists are sorted by, as for list_sort.
+ */
+void list_merge_sorted(list* lhs, list* rhs, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(lhs != NULL && rhs != NULL && lhs != rhs && compare != NULL);
+    assert(lhs->element_size == rhs->element_size);
+
+    if (rhs->size == 0) {
+        return;
+    }
+    node* cur = lhs->head;
+    while (rhs->size > 0) {
+        node* first = rhs->head;
+        while (cur != NULL && compare(cur->val, first->val) <= 0) {
+            cur = cur->next;
+        }
+        if (cur == NULL) {
+            list_move_range(lhs, NULL, rhs, first, rhs->tail, rhs->size);
+            break;
+        }
+        node* last = first;
+        size_t count = 1;
+        while (last->next != NULL && compare(last->next->val, cur->val) < 0) {
+            last = last->next;
+            count++;
+        }
+        list_move_range(lhs, cur, rhs, first, last, count);
+    }
+}
+
 /**
  * @brief Reverses the specified list in place.
  *
@@ -392,33 +879,221 @@ void list_copy_to_array(const list* list, void* array) {
 }
 
 /**
- * @brief Sorts the specified list in place.
+ * @brief Sorts the specified list in place with a stable natural merge sort.
+ *        The nodes are relinked, so no memory is allocated and the values are not moved.
  *
  * @param list The list will be sorted.
- * @param compare The compare function used to sort the list.
+ * @param compare The compare function used to sort the list, it receives the element values as for vector_sort.
  */
-void list_sort(list* list, int (*compare)(const void* right, const void* left)) {
+void list_sort(list* list, int (* compare)(const void* lhs, const void* rhs)) {
     assert(list != NULL && compare != NULL);
 
-    node** node_arr = (node **) malloc(sizeof(node *) * list->size);
-    size_t offset = 0;
-    list_for_each(node, list) {
-        node_arr[offset] = node;
-        offset++;
+    if (list->size < 2) {
+        return;
+    }
+    size_t runs;
+    do {
+        node* rest = list->head;
+        node* tail = NULL;
+        runs = 0;
+        while (rest != NULL) {
+            node* first = rest;
+            rest = list_cut_run(rest, compare);
+            node* second = rest;
+            if (rest != NULL) {
+                rest = list_cut_run(rest, compare);
+            }
+            node* run_tail;
+            node* run = list_merge_runs(first, second, compare, &run_tail);
+            if (tail == NULL)
+                list->head = run;
+            else
+                tail->next = run;
+            tail = run_tail;
+            runs++;
+        }
+    } while (runs > 1);
+
+    node* prev = NULL;
+    for (node* cur = list->head; cur != NULL; cur = cur->next) {
+        cur->prev = prev;
+        prev = cur;
     }
-    qsort(node_arr, list->size, sizeof(node *), compare);
+    list->tail = prev;
+}
 
-    node* cur = node_arr[0];
-    list->head = cur;
-    list->head->prev = NULL;
-    for(size_t i = 1; i < list->size; i++) {
-        node_arr[i]->prev = cur;
-        cur->next = node_arr[i];
+/**
+ * @brief Moves the values of the list into one new slab in traversal order and relinks them,
+ *        so a traversal reads memory sequentially again. The free nodes are dropped and the
+ *        old nodes released, every node pointer and cursor of the list is invalidated.
+ *
+ * @param list The list to be defragmented.
+ */
+void list_defragment(list* list) {
+    assert(list != NULL);
+
+    list_slab* slabs = list->slabs;
+    size_t count = list->capacity > list->size ? list->capacity : list->size;
+    node* first = list->head;
+    node* cur = first;
+    list->head = NULL;
+    list->tail = NULL;
+    list->capacity = 0;
+    list->free_nodes = NULL;
+    list->slab_cursor = NULL;
+    list->slab_end = NULL;
+    list->slabs = NULL;
+    list->slabs_size = 0;
+    list->churn = 0;
+    if (count > 0) {
+        list_add_slab(list, count);
+    }
+    node* prev = NULL;
+    while (cur != NULL) {
+        node* node_ptr = list_carve_node(list);
+        memcpy(node_ptr->val, cur->val, list->element_size);
+        node_ptr->prev = prev;
+        if (prev != NULL)
+            prev->next = node_ptr;
+        else
+            list->head = node_ptr;
+        prev = node_ptr;
         cur = cur->next;
     }
-    list->tail = cur;
-    list->tail->next = NULL;
+    if (prev != NULL) {
+        prev->next = NULL;
+    }
+    list->tail = prev;
+    list_drop(list, first, slabs);
+}
+
+/**
+ * @brief Sets the number of nodes removed since the last defragmentation
+ *        at which list_maybe_defragment defragments the list.
+ *
+ * @param list The list to be configured.
+ * @param churn The number of removed nodes triggering a defragmentation, 0 disables it.
+ */
+void list_set_defragment_threshold(list* list, size_t churn) {
+    assert(list != NULL);
+
+    list->defragment_threshold = churn;
+}
+
+/**
+ * @brief Defragments the list if the churn reached its non-zero defragment threshold.
+ *        No other function defragments on its own, so the caller picks a point where
+ *        no node pointer or cursor of the list is held.
+ *
+ * @param list The list to be defragmented.
+ *
+ * @return Whether or not the list was defragmented, invalidating its node pointers.
+ */
+bool list_maybe_defragment(list* list) {
+    assert(list != NULL);
+
+    if (list->defragment_threshold == 0 || list->churn < list->defragment_threshold) {
+        return false;
+    }
+    list_defragment(list);
+    return true;
+}
+
+/**
+ * @brief Gets a cursor at the first node of the specified list.
+ *
+ * @param list The list to be walked.
+ *
+ * @return The cursor, past the end if the list is empty.
+ */
+list_cursor list_cursor_front(list* list) {
+    assert(list != NULL);
+
+    list_cursor cursor = {list, list->head};
+    return cursor;
+}
+
+/**
+ * @brief Gets a cursor at the last node of the specified list.
+ *
+ * @param list The list to be walked.
+ *
+ * @return The cursor, past the end if the list is empty.
+ */
+list_cursor list_cursor_back(list* list) {
+    assert(list != NULL);
+
+    list_cursor cursor = {list, list->tail};
+    return cursor;
+}
+
+/**
+ * @brief Checks whether or not the cursor is at a node.
+ *
+ * @param cursor The cursor to be checked.
+ *
+ * @return Whether or not the cursor is at a node.
+ */
+bool list_cursor_is_valid(const list_cursor* cursor) {
+    assert(cursor != NULL);
+
+    return cursor->current != NULL;
+}
+
+/**
+ * @brief Moves the cursor to the next node, past the end after the tail.
+ *
+ * @param cursor The cursor to be moved.
+ */
+void list_cursor_next(list_cursor* cursor) {
+    assert(cursor != NULL && cursor->current != NULL);
+
+    cursor->current = cursor->current->next;
+}
+
+/**
+ * @brief Moves the cursor to the previous node, from past the end to the tail.
+ *
+ * @param cursor The cursor to be moved.
+ */
+void list_cursor_prev(list_cursor* cursor) {
+    assert(cursor != NULL && cursor->current != cursor->list->head);
+
+    cursor->current = cursor->current != NULL ? cursor->current->prev : cursor->list->tail;
+}
+
+/**
+ * @brief Gets the value of the node the cursor is at.
+ *
+ * @param cursor The valid cursor.
+ *
+ * @return A pointer to the value.
+ */
+void* list_cursor_get(const list_cursor* cursor) {
+    assert(cursor != NULL && cursor->current != NULL);
+
+    return cursor->current->val;
+}
+
+/**
+ * @brief Inserts a new node with the specified value before the cursor, which stays at its node.
+ *
+ * @param cursor The cursor, past the end inserts at the end.
+ * @param val The value of the node to be added.
+ */
+void list_cursor_insert_before(list_cursor* cursor, const void* val) {
+    assert(cursor != NULL && val != NULL);
+
+    list_insert_before(cursor->list, cursor->current, val);
+}
+
+/**
+ * @brief Removes the node the cursor is at and moves the cursor to the next node.
+ *
+ * @param cursor The valid cursor.
+ */
+void list_cursor_erase(list_cursor* cursor) {
+    assert(cursor != NULL && cursor->current != NULL);
 
-    free(node_arr);
-    node_arr = NULL;
+    cursor->current = list_erase(cursor->list, cursor->current);
 }
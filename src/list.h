@@ -21,30 +21,89 @@ extern "C" {
 
 /* Struct type declaration */
 struct node;
+struct list_slab;
 struct list;
+struct list_cursor;
 
 /* Typedefs */
 typedef struct node node;
+typedef struct list_slab list_slab;
 typedef struct list list;
+typedef struct list_cursor list_cursor;
 typedef uint8_t byte;
 
 /**
  * Define the struct represent the node that make list.
+ *
+ * The value is stored inline after the links, so a node is a single
+ * allocation and reading the value does not follow another pointer.
+ * Slab is the block the node was carved out of, it follows the node
+ * into any list the node is spliced into.
  */
 struct node {
-    void* val;
     node* next;
     node* prev;
+    list_slab* slab;
+    _Alignas(max_align_t) byte val[];
+};
+
+/**
+ * Define the struct represent the header of a block of nodes.
+ *
+ * Live counts the nodes of the slab linked in a list, whichever list it is.
+ * The owner is the list which allocated the slab and reuses its removed
+ * nodes. It is NULL once the owner was cleared while some nodes were still
+ * linked in another list, the slab is then freed with its last live node.
+ */
+struct list_slab {
+    list* owner;
+    list_slab* next;
+    list_slab* prev;
+    size_t count;
+    size_t live;
 };
 
 /**
  * Define the struct represent doubly linked list.
+ *
+ * The nodes are carved out of slabs owned by the list and a removed node is
+ * kept in the free nodes of its slab owner for the next insertion. A list that
+ * stays under its capacity inserts and removes without calling malloc or free.
+ * The free nodes are doubly linked, so a slab whose nodes are all free is
+ * unlinked and freed at once, except the newest slab the nodes are carved
+ * from. Growing slabs hold at most LIST_SLAB_MAX_NODES, so an emptied list
+ * keeps at most that many nodes unless more were reserved.
+ * Nodes move between lists by relinking alone, lists which exchanged nodes must
+ * be used by one thread, and a list must not be moved in memory while it owns
+ * slabs.
+ *
+ * Churn counts the nodes removed since the nodes were last laid out in
+ * order. Once it reaches a non-zero defragment threshold, the next
+ * list_maybe_defragment call defragments the list, nothing else does.
  */
 struct list {
     node* head;
     node* tail;
     size_t size;
     size_t element_size;
+    size_t capacity;
+    node* free_nodes;
+    byte* slab_cursor;
+    byte* slab_end;
+    list_slab* slabs;
+    size_t slabs_size;
+    size_t churn;
+    size_t defragment_threshold;
+};
+
+/**
+ * Define the struct represent a bidirectional cursor over the list nodes.
+ * A NULL current node is the position past the end, moving back from it
+ * reaches the tail.
+ */
+struct list_cursor {
+    list* list;
+    node* current;
 };
 
 
@@ -52,6 +111,7 @@ struct list {
 
 /* Initialization */
 void list_init(list* list, size_t element_size);
+void list_from_array(list* list, const void* array, size_t array_size);
 
 /* Accessing */
 node* list_back(const list* list);
@@ -63,25 +123,51 @@ int list_index_of(const list* list, const void* val);
 void list_push_back(list* list, const void* val);
 void list_push_front(list* list, const void* val);
 void list_insert_at(list* list, const void* val, size_t index);
+node* list_insert_before(list* list, node* position, const void* val);
+node* list_insert_after(list* list, node* position, const void* val);
+void list_append_array(list* list, const void* array, size_t array_size);
 
 /* Removal */
 void list_pop_back(list* list);
 void list_pop_front(list* list);
 void list_remove_at(list* list, size_t index);
+node* list_erase(list* list, node* position);
 void list_remove(list* list, const void* val);
 void list_clear(list* list);
 
 /* Utility */
 size_t list_size(const list* list);
+size_t list_capacity(const list* list);
 bool list_is_empty(const list* list);
+void list_reserve(list* list, size_t new_capacity);
 void list_merge(const list* lhs, const list* rhs, list* dest);
+void list_splice(list* dest, node* position, list* src, node* first, node* last);
+void list_concat(list* lhs, list* rhs);
+void list_split_at(list* src, size_t index, list* dest);
+void list_merge_sorted(list* lhs, list* rhs, int (* compare)(const void* lhs, const void* rhs));
 void list_reverse(list* list);
 void list_copy_to_array(const list* list, void* array);
-void list_sort(list* list, int (*compare)(const void* right, const void* left));
+void list_sort(list* list, int (* compare)(const void* lhs, const void* rhs));
+void list_defragment(list* list);
+void list_set_defragment_threshold(list* list, size_t churn);
+bool list_maybe_defragment(list* list);
+
+/* Cursor */
+list_cursor list_cursor_front(list* list);
+list_cursor list_cursor_back(list* list);
+bool list_cursor_is_valid(const list_cursor* cursor);
+void list_cursor_next(list_cursor* cursor);
+void list_cursor_prev(list_cursor* cursor);
+void* list_cursor_get(const list_cursor* cursor);
+void list_cursor_insert_before(list_cursor* cursor, const void* val);
+void list_cursor_erase(list_cursor* cursor);
 
 
 /* M A C R O S */
 
+#define LIST_SLAB_MIN_NODES 32
+#define LIST_SLAB_MAX_NODES 4096
+
 #define list_for_each(node_ptr, list_ptr)     \
     for (node* node_ptr = (list_ptr)->head;   \
          node_ptr != (list_ptr)->tail->next;  \
@@ -0,0 +1,391 @@
+#include "lockfree_list.h"
+
+/**
+ * @brief Gets the node a link points to, without its deletion mark.
+ */
+static lockfree_node* lockfree_list_unmark(uintptr_t link) {
+    return (lockfree_node *) (link & ~(uintptr_t) 1);
+}
+
+/**
+ * @brief Checks whether the link is the next of a logically deleted node.
+ */
+static bool lockfree_list_is_marked(uintptr_t link) {
+    return (link & 1) != 0;
+}
+
+/**
+ * @brief Create a new unlinked node holding a copy of the specified value.
+ *
+ * @param list The list the node belongs to.
+ * @param val The value of the node, or NULL for the head sentinel.
+ *
+ * @return A pointer to the newly created node.
+ */
+static lockfree_node* lockfree_list_create_node(const lockfree_list* list, const void* val) {
+    lockfree_node* node = (lockfree_node *) malloc(sizeof(lockfree_node) + sizeof(byte) * list->element_size);
+    atomic_init(&node->next, (uintptr_t) 0);
+    node->retired_next = NULL;
+    if (val != NULL) {
+        memcpy(node->val, val, list->element_size);
+    }
+    return node;
+}
+
+/**
+ * @brief Frees the retired nodes in the specified bin of the handle.
+ */
+static void lockfree_list_free_bin(lockfree_list_handle* handle, size_t bin) {
+    lockfree_node* node = handle->retired[bin];
+    while (node != NULL) {
+        lockfree_node* next = node->retired_next;
+        free(node);
+        node = next;
+    }
+    handle->retired[bin] = NULL;
+    handle->retired_counts[bin] = 0;
+}
+
+/**
+ * @brief Advances the global epoch when every thread inside the list has entered it.
+ *
+ * @param list The list whose epoch will be advanced.
+ */
+static void lockfree_list_try_advance(lockfree_list* list) {
+    size_t epoch = atomic_load(&list->epoch);
+    for (lockfree_list_handle* handle = atomic_load(&list->handles); handle != NULL; handle = handle->next) {
+        size_t local_epoch = atomic_load(&handle->local_epoch);
+        if ((local_epoch & 1) != 0 && (local_epoch >> 1) != epoch) {
+            return;
+        }
+    }
+    atomic_compare_exchange_strong(&list->epoch, &epoch, epoch + 1);
+}
+
+/**
+ * @brief Announces the thread of the handle as reading the list in the current epoch,
+ *        and frees the nodes it retired two epochs ago or before.
+ *
+ * @param list The list to be entered.
+ * @param handle The handle of the calling thread.
+ */
+static void lockfree_list_enter(lockfree_list* list, lockfree_list_handle* handle) {
+    size_t epoch = atomic_load(&list->epoch);
+    atomic_store(&handle->local_epoch, (epoch << 1) | 1);
+    for (size_t bin = 0; bin < 3; bin++) {
+        if (handle->retired[bin] != NULL && handle->retired_epochs[bin] + 2 <= epoch) {
+            lockfree_list_free_bin(handle, bin);
+        }
+    }
+}
+
+/**
+ * @brief Announces the thread of the handle as no longer reading the list.
+ *
+ * @param handle The handle of the calling thread.
+ */
+static void lockfree_list_exit(lockfree_list_handle* handle) {
+    atomic_store_explicit(&handle->local_epoch, (size_t) 0, memory_order_release);
+}
+
+/**
+ * @brief Keeps an unlinked node until no thread can still read it. The node is filed
+ *        under the global epoch read now, a thread which reached it may have entered
+ *        any epoch up to this one.
+ *
+ * @param list The list the node was unlinked from.
+ * @param handle The handle of the thread which unlinked the node.
+ * @param node The unlinked node.
+ */
+static void lockfree_list_retire(lockfree_list* list, lockfree_list_handle* handle, lockfree_node* node) {
+    size_t epoch = atomic_load(&list->epoch);
+    size_t bin = epoch % 3;
+    if (handle->retired_epochs[bin] != epoch) {
+        lockfree_list_free_bin(handle, bin);
+        handle->retired_epochs[bin] = epoch;
+    }
+    node->retired_next = handle->retired[bin];
+    handle->retired[bin] = node;
+    handle->retired_counts[bin]++;
+    if (handle->retired_counts[bin] >= LOCKFREE_LIST_RETIRE_THRESHOLD) {
+        lockfree_list_try_advance(list);
+    }
+}
+
+/**
+ * @brief Finds the first node whose value is not less than the specified value,
+ *        unlinking the marked nodes on the way.
+ *
+ * @param list The list to be searched.
+ * @param handle The handle of the calling thread.
+ * @param val The value to be searched for.
+ * @param prev Receives the link pointing to the found node.
+ * @param cur Receives the found node, or NULL at the end of the list.
+ *
+ * @return Whether or not the found node holds the value.
+ */
+static bool lockfree_list_search(lockfree_list* list, lockfree_list_handle* handle, const void* val,
+                                 _Atomic uintptr_t** prev, lockfree_node** cur) {
+retry:
+    *prev = &list->head->next;
+    *cur = lockfree_list_unmark(atomic_load(*prev));
+    while (*cur != NULL) {
+        uintptr_t next = atomic_load(&(*cur)->next);
+        if (lockfree_list_is_marked(next)) {
+            uintptr_t expected = (uintptr_t) *cur;
+            if (!atomic_compare_exchange_strong(*prev, &expected, (uintptr_t) lockfree_list_unmark(next))) {
+                goto retry;
+            }
+            lockfree_list_retire(list, handle, *cur);
+            *cur = lockfree_list_unmark(next);
+            continue;
+        }
+        int cmp = list->compare((*cur)->val, val);
+        if (cmp >= 0) {
+            return cmp == 0;
+        }
+        *prev = &(*cur)->next;
+        *cur = lockfree_list_unmark(next);
+    }
+    return false;
+}
+
+/**
+ * @brief Initialize the lock-free list, it must not be accessed before this returns.
+ *
+ * @param list The list to be initialized.
+ * @param element_size The size in bytes of each element in the list.
+ * @param compare The compare function used to order the elements.
+ */
+void lockfree_list_init(lockfree_list* list, size_t element_size,
+                        int (* compare)(const void* lhs, const void* rhs)) {
+    assert(list != NULL && element_size > 0 && compare != NULL);
+
+    list->element_size = element_size;
+    list->compare = compare;
+    list->head = lockfree_list_create_node(list, NULL);
+    atomic_init(&list->handles, (lockfree_list_handle *) NULL);
+    atomic_init(&list->epoch, (size_t) 0);
+    atomic_init(&list->size, (size_t) 0);
+}
+
+/**
+ * @brief Gets a handle for the calling thread to access the list, reusing a detached one when possible.
+ *
+ * @param list The list to be accessed.
+ *
+ * @return The handle to be passed to the list functions by the calling thread only.
+ */
+lockfree_list_handle* lockfree_list_attach(lockfree_list* list) {
+    assert(list != NULL);
+
+    for (lockfree_list_handle* handle = atomic_load(&list->handles); handle != NULL; handle = handle->next) {
+        bool in_use = false;
+        if (!atomic_load(&handle->in_use) && atomic_compare_exchange_strong(&handle->in_use, &in_use, true)) {
+            return handle;
+        }
+    }
+    lockfree_list_handle* handle = (lockfree_list_handle *) malloc(sizeof(lockfree_list_handle));
+    atomic_init(&handle->local_epoch, (size_t) 0);
+    atomic_init(&handle->in_use, true);
+    for (size_t i = 0; i < 3; i++) {
+        handle->retired[i] = NULL;
+        handle->retired_epochs[i] = 0;
+        handle->retired_counts[i] = 0;
+    }
+    handle->next = atomic_load(&list->handles);
+    while (!atomic_compare_exchange_weak(&list->handles, &handle->next, handle));
+    return handle;
+}
+
+/**
+ * @brief Releases the handle of the calling thread for another thread to attach,
+ *        its retired nodes are freed by the next owner or by destroy.
+ *
+ * @param list The list the handle belongs to.
+ * @param handle The handle to be released.
+ */
+void lockfree_list_detach(lockfree_list* list, lockfree_list_handle* handle) {
+    assert(list != NULL && handle != NULL && atomic_load(&handle->in_use));
+
+    atomic_store(&handle->in_use, false);
+}
+
+/**
+ * @brief Checks whether the list holds the specified value, in a bounded number
+ *        of steps without writing shared memory.
+ *
+ * @param list The list to be searched.
+ * @param handle The handle of the calling thread.
+ * @param val The value to be searched for.
+ *
+ * @return Whether or not the value is in the list.
+ */
+bool lockfree_list_contains(lockfree_list* list, lockfree_list_handle* handle, const void* val) {
+    assert(list != NULL && handle != NULL && val != NULL);
+
+    lockfree_list_enter(list, handle);
+    lockfree_node* cur = lockfree_list_unmark(atomic_load(&list->head->next));
+    while (cur != NULL && list->compare(cur->val, val) < 0) {
+        cur = lockfree_list_unmark(atomic_load(&cur->next));
+    }
+    bool found = cur != NULL && list->compare(cur->val, val) == 0 &&
+                 !lockfree_list_is_marked(atomic_load(&cur->next));
+    lockfree_list_exit(handle);
+    return found;
+}
+
+/**
+ * @brief Insert a copy of the specified value at its sorted position unless it is already in the list.
+ *
+ * @param list A pointer to the list to add to.
+ * @param handle The handle of the calling thread.
+ * @param val The value to be added to the list.
+ *
+ * @return Whether or not the value was added.
+ */
+bool lockfree_list_insert(lockfree_list* list, lockfree_list_handle* handle, const void* val) {
+    assert(list != NULL && handle != NULL && val != NULL);
+
+    lockfree_node* node = lockfree_list_create_node(list, val);
+    lockfree_list_enter(list, handle);
+    bool inserted = false;
+    while (true) {
+        _Atomic uintptr_t* prev;
+        lockfree_node* cur;
+        if (lockfree_list_search(list, handle, val, &prev, &cur)) {
+            break;
+        }
+        atomic_store_explicit(&node->next, (uintptr_t) cur, memory_order_relaxed);
+        uintptr_t expected = (uintptr_t) cur;
+        if (atomic_compare_exchange_strong(prev, &expected, (uintptr_t) node)) {
+            inserted = true;
+            break;
+        }
+    }
+    lockfree_list_exit(handle);
+    if (inserted) {
+        atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+    }
+    else {
+        free(node);
+    }
+    return inserted;
+}
+
+/**
+ * @brief Remove the specified value from the list, the node is marked first then unlinked.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param handle The handle of the calling thread.
+ * @param val The value to be removed.
+ *
+ * @return Whether or not the value was removed by this call.
+ */
+bool lockfree_list_remove(lockfree_list* list, lockfree_list_handle* handle, const void* val) {
+    assert(list != NULL && handle != NULL && val != NULL);
+
+    lockfree_list_enter(list, handle);
+    bool removed = false;
+    while (true) {
+        _Atomic uintptr_t* prev;
+        lockfree_node* cur;
+        if (!lockfree_list_search(list, handle, val, &prev, &cur)) {
+            break;
+        }
+        uintptr_t next = atomic_load(&cur->next);
+        if (lockfree_list_is_marked(next) ||
+            !atomic_compare_exchange_strong(&cur->next, &next, next | 1)) {
+            continue;
+        }
+        removed = true;
+        uintptr_t expected = (uintptr_t) cur;
+        if (atomic_compare_exchange_strong(prev, &expected, next)) {
+            lockfree_list_retire(list, handle, cur);
+        }
+        else {
+            lockfree_list_search(list, handle, val, &prev, &cur);
+        }
+        break;
+    }
+    lockfree_list_exit(handle);
+    if (removed) {
+        atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+    }
+    return removed;
+}
+
+/**
+ * @brief Frees the nodes and the handles of the list, no thread may access it anymore.
+ *
+ * @param list A pointer to the list to free from.
+ */
+void lockfree_list_destroy(lockfree_list* list) {
+    assert(list != NULL && list->head != NULL);
+
+    lockfree_node* node = list->head;
+    while (node != NULL) {
+        lockfree_node* next = lockfree_list_unmark(atomic_load(&node->next));
+        free(node);
+        node = next;
+    }
+    list->head = NULL;
+    lockfree_list_handle* handle = atomic_load(&list->handles);
+    while (handle != NULL) {
+        lockfree_list_handle* next = handle->next;
+        for (size_t i = 0; i < 3; i++) {
+            lockfree_list_free_bin(handle, i);
+        }
+        free(handle);
+        handle = next;
+    }
+    atomic_store(&list->handles, (lockfree_list_handle *) NULL);
+    atomic_store(&list->size, (size_t) 0);
+}
+
+/**
+ * @brief Gets the number of elements in the specified list, it may be stale under concurrent updates.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The number of elements in the list.
+ */
+size_t lockfree_list_size(const lockfree_list* list) {
+    assert(list != NULL);
+
+    return atomic_load_explicit((atomic_size_t *) &list->size, memory_order_relaxed);
+}
+
+/**
+ * @brief Checks whether the list is empty or not.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool lockfree_list_is_empty(const lockfree_list* list) {
+    assert(list != NULL);
+
+    return lockfree_list_size(list) == 0;
+}
+
+/**
+ * @brief Copies the list elements in order to the specified array, no thread may update the list meanwhile.
+ *
+ * @param list The list whose elements will be copied.
+ * @param array The array to be filled, it must hold size elements.
+ */
+void lockfree_list_copy_to_array(const lockfree_list* list, void* array) {
+    assert(list != NULL && array != NULL);
+
+    byte* dest = (byte *) array;
+    lockfree_node* cur = lockfree_list_unmark(atomic_load(&list->head->next));
+    while (cur != NULL) {
+        uintptr_t next = atomic_load(&cur->next);
+        if (!lockfree_list_is_marked(next)) {
+            memcpy(dest, cur->val, list->element_size);
+            dest += list->element_size;
+        }
+        cur = lockfree_list_unmark(next);
+    }
+}
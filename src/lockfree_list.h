@@ -0,0 +1,116 @@
+/**
+ * @file     lockfree_list.h
+ *
+ * @brief    The Implementation of Lock-Free Ordered Linked List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef LOCKFREE_LIST_H
+#define LOCKFREE_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct lockfree_node;
+struct lockfree_list_handle;
+struct lockfree_list;
+
+/* Typedefs */
+typedef struct lockfree_node lockfree_node;
+typedef struct lockfree_list_handle lockfree_list_handle;
+typedef struct lockfree_list lockfree_list;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the node that make lock-free list.
+ *
+ * The lowest bit of next marks the node as logically deleted, a marked node
+ * is unlinked by the next thread walking past it. A node unlinked from the
+ * list is chained through retired_next until no thread can still read it.
+ */
+struct lockfree_node {
+    _Atomic uintptr_t next;
+    lockfree_node* retired_next;
+    _Alignas(max_align_t) byte val[];
+};
+
+/**
+ * Define the struct represent the per-thread state used by a thread to access the list.
+ *
+ * A thread announces the epoch it entered in local_epoch while it reads
+ * the list, and keeps the nodes it unlinked in the bin of the global epoch
+ * read after unlinking them, not the one it entered in, which may already
+ * be behind. A node retired in epoch e is freed once the global epoch
+ * reaches e + 2, which needs every thread inside the list to have entered
+ * epoch e + 1, after the node was unlinked.
+ */
+struct lockfree_list_handle {
+    lockfree_list_handle* next;
+    _Atomic size_t local_epoch;
+    atomic_bool in_use;
+    lockfree_node* retired[3];
+    size_t retired_epochs[3];
+    size_t retired_counts[3];
+};
+
+/**
+ * Define the struct represent the lock-free sorted set of fixed size values.
+ *
+ * Insert and remove are lock-free with the marked pointer algorithm of
+ * Harris, contains is wait-free and never writes shared memory. The
+ * removed nodes are reclaimed with epochs, so every thread accessing the
+ * list must attach to get its handle.
+ */
+struct lockfree_list {
+    lockfree_node* head;
+    _Atomic(lockfree_list_handle *) handles;
+    _Atomic size_t epoch;
+    atomic_size_t size;
+    size_t element_size;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void lockfree_list_init(lockfree_list* list, size_t element_size,
+                        int (* compare)(const void* lhs, const void* rhs));
+lockfree_list_handle* lockfree_list_attach(lockfree_list* list);
+void lockfree_list_detach(lockfree_list* list, lockfree_list_handle* handle);
+
+/* Accessing */
+bool lockfree_list_contains(lockfree_list* list, lockfree_list_handle* handle, const void* val);
+
+/* Insertion */
+bool lockfree_list_insert(lockfree_list* list, lockfree_list_handle* handle, const void* val);
+
+/* Removal */
+bool lockfree_list_remove(lockfree_list* list, lockfree_list_handle* handle, const void* val);
+void lockfree_list_destroy(lockfree_list* list);
+
+/* Utility */
+size_t lockfree_list_size(const lockfree_list* list);
+bool lockfree_list_is_empty(const lockfree_list* list);
+void lockfree_list_copy_to_array(const lockfree_list* list, void* array);
+
+
+/* M A C R O S */
+
+#define LOCKFREE_LIST_RETIRE_THRESHOLD 64
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LOCKFREE_LIST_H */
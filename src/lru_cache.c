@@ -0,0 +1,272 @@
+#include "lru_cache.h"
+
+/**
+ * @brief Gets the home slot of the specified key in the index.
+ */
+static size_t lru_cache_slot(const lru_cache* cache, const void* key) {
+    return (size_t) hash_bytes(key, cache->key_size, 0) & cache->index_mask;
+}
+
+/**
+ * @brief Finds the index slot holding the node of the specified key.
+ *
+ * @param cache The cache to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return The slot of the node, or the empty slot ending the probe if the key is absent.
+ */
+static size_t lru_cache_find_slot(const lru_cache* cache, const void* key) {
+    size_t slot = lru_cache_slot(cache, key);
+    while (cache->index[slot] != NULL && memcmp(cache->index[slot]->val, key, cache->key_size) != 0) {
+        slot = (slot + 1) & cache->index_mask;
+    }
+    return slot;
+}
+
+/**
+ * @brief Empties the specified index slot, shifting back the nodes probed past it.
+ *
+ * @param cache The cache whose index will be updated.
+ * @param slot The slot to be emptied.
+ */
+static void lru_cache_unindex(lru_cache* cache, size_t slot) {
+    size_t next = (slot + 1) & cache->index_mask;
+    while (cache->index[next] != NULL) {
+        size_t home = lru_cache_slot(cache, cache->index[next]->val);
+        if (((next - home) & cache->index_mask) >= ((next - slot) & cache->index_mask)) {
+            cache->index[slot] = cache->index[next];
+            slot = next;
+        }
+        next = (next + 1) & cache->index_mask;
+    }
+    cache->index[slot] = NULL;
+}
+
+/**
+ * @brief Moves the specified entry to the head of the list by relinking it.
+ */
+static void lru_cache_promote(lru_cache* cache, node* entry) {
+    if (entry != cache->entries.head) {
+        list_splice(&cache->entries, cache->entries.head, &cache->entries, entry, entry);
+    }
+}
+
+/**
+ * @brief Initialize the LRU cache, the nodes of all the entries are allocated at once.
+ *
+ * @param cache The cache to be initialized.
+ * @param key_size The size in bytes of each key, keys are compared bytewise.
+ * @param value_size The size in bytes of each value.
+ * @param capacity The maximum number of entries before the least recently used is evicted.
+ */
+void lru_cache_init(lru_cache* cache, size_t key_size, size_t value_size, size_t capacity) {
+    assert(cache != NULL && key_size > 0 && value_size > 0 && capacity > 0);
+
+    size_t align = value_size & (~value_size + 1);
+    if (align > _Alignof(max_align_t))
+        align = _Alignof(max_align_t);
+    size_t index_size = 1;
+    while (index_size < capacity * 2) {
+        index_size *= 2;
+    }
+    cache->key_size = key_size;
+    cache->value_size = value_size;
+    cache->value_offset = (key_size + align - 1) / align * align;
+    cache->capacity = capacity;
+    cache->index = (node **) calloc(index_size, sizeof(node *));
+    cache->index_mask = index_size - 1;
+    cache->scratch = (byte *) malloc(sizeof(byte) * (cache->value_offset + value_size));
+    cache->hits = 0;
+    cache->misses = 0;
+    list_init(&cache->entries, cache->value_offset + value_size);
+    list_reserve(&cache->entries, capacity);
+}
+
+/**
+ * @brief Retrieves the value of the specified key and marks it as the most recently used.
+ *        Counts a hit or a miss.
+ *
+ * @param cache The cache to be searched.
+ * @param key The key whose value wanted to be retrieved.
+ *
+ * @return A pointer to the value or NULL if the key is not cached.
+ */
+void* lru_cache_get(lru_cache* cache, const void* key) {
+    assert(cache != NULL && cache->index != NULL && key != NULL);
+
+    node* entry = cache->index[lru_cache_find_slot(cache, key)];
+    if (entry == NULL) {
+        cache->misses++;
+        return NULL;
+    }
+    cache->hits++;
+    lru_cache_promote(cache, entry);
+    return lru_cache_value(cache, entry);
+}
+
+/**
+ * @brief Retrieves the value of the specified key without changing its recency or the counters.
+ *
+ * @param cache The cache to be searched.
+ * @param key The key whose value wanted to be retrieved.
+ *
+ * @return A pointer to the value or NULL if the key is not cached.
+ */
+void* lru_cache_peek(const lru_cache* cache, const void* key) {
+    assert(cache != NULL && cache->index != NULL && key != NULL);
+
+    node* entry = cache->index[lru_cache_find_slot(cache, key)];
+    return entry != NULL ? lru_cache_value(cache, entry) : NULL;
+}
+
+/**
+ * @brief Checks whether the specified key is cached.
+ *
+ * @param cache The cache to be searched.
+ * @param key The key to be searched for.
+ *
+ * @return Whether or not the key is cached.
+ */
+bool lru_cache_contains(const lru_cache* cache, const void* key) {
+    assert(cache != NULL && cache->index != NULL && key != NULL);
+
+    return cache->index[lru_cache_find_slot(cache, key)] != NULL;
+}
+
+/**
+ * @brief Stores a copy of the value for the specified key as the most recently used entry.
+ *        When the cache is full the least recently used entry is evicted and its node reused.
+ *
+ * @param cache A pointer to the cache to add to.
+ * @param key The key of the entry.
+ * @param value The value of the entry.
+ */
+void lru_cache_put(lru_cache* cache, const void* key, const void* value) {
+    assert(cache != NULL && cache->index != NULL && key != NULL && value != NULL);
+
+    size_t slot = lru_cache_find_slot(cache, key);
+    node* entry = cache->index[slot];
+    if (entry != NULL) {
+        memcpy(lru_cache_value(cache, entry), value, cache->value_size);
+        lru_cache_promote(cache, entry);
+        return;
+    }
+    if (cache->entries.size == cache->capacity) {
+        entry = cache->entries.tail;
+        lru_cache_unindex(cache, lru_cache_find_slot(cache, entry->val));
+        slot = lru_cache_find_slot(cache, key);
+        memcpy(entry->val, key, cache->key_size);
+        memcpy(lru_cache_value(cache, entry), value, cache->value_size);
+        lru_cache_promote(cache, entry);
+    }
+    else {
+        memcpy(cache->scratch, key, cache->key_size);
+        memcpy(cache->scratch + cache->value_offset, value, cache->value_size);
+        list_push_front(&cache->entries, cache->scratch);
+        entry = cache->entries.head;
+    }
+    cache->index[slot] = entry;
+}
+
+/**
+ * @brief Remove the entry of the specified key, its node is kept for the next insertion.
+ *
+ * @param cache A pointer to the cache to remove from.
+ * @param key The key of the entry to be removed.
+ *
+ * @return Whether or not the key was cached.
+ */
+bool lru_cache_remove(lru_cache* cache, const void* key) {
+    assert(cache != NULL && cache->index != NULL && key != NULL);
+
+    size_t slot = lru_cache_find_slot(cache, key);
+    node* entry = cache->index[slot];
+    if (entry == NULL) {
+        return false;
+    }
+    lru_cache_unindex(cache, slot);
+    list_erase(&cache->entries, entry);
+    return true;
+}
+
+/**
+ * @brief Remove all the entries of the cache and free its memory.
+ *
+ * @param cache A pointer to the cache to remove from.
+ */
+void lru_cache_clear(lru_cache* cache) {
+    assert(cache != NULL);
+
+    list_clear(&cache->entries);
+    free(cache->index);
+    cache->index = NULL;
+    free(cache->scratch);
+    cache->scratch = NULL;
+    cache->index_mask = 0;
+    cache->capacity = 0;
+}
+
+/**
+ * @brief Gets the number of entries in the specified cache.
+ *
+ * @param cache The cache whose size will be returned.
+ *
+ * @return The number of entries in the cache.
+ */
+size_t lru_cache_size(const lru_cache* cache) {
+    assert(cache != NULL);
+
+    return cache->entries.size;
+}
+
+/**
+ * @brief Gets the maximum number of entries of the specified cache.
+ *
+ * @param cache The cache whose capacity will be returned.
+ *
+ * @return The number of entries the cache holds before evicting.
+ */
+size_t lru_cache_capacity(const lru_cache* cache) {
+    assert(cache != NULL);
+
+    return cache->capacity;
+}
+
+/**
+ * @brief Checks whether the cache is empty or not.
+ *
+ * @param cache The cache to be checked.
+ *
+ * @return Whether or not the cache is empty.
+ */
+bool lru_cache_is_empty(const lru_cache* cache) {
+    assert(cache != NULL);
+
+    return cache->entries.size == 0;
+}
+
+/**
+ * @brief Gets the number of lru_cache_get calls which found their key.
+ *
+ * @param cache The cache whose hits will be returned.
+ *
+ * @return The number of hits.
+ */
+size_t lru_cache_hits(const lru_cache* cache) {
+    assert(cache != NULL);
+
+    return cache->hits;
+}
+
+/**
+ * @brief Gets the number of lru_cache_get calls which did not find their key.
+ *
+ * @param cache The cache whose misses will be returned.
+ *
+ * @return The number of misses.
+ */
+size_t lru_cache_misses(const lru_cache* cache) {
+    assert(cache != NULL);
+
+    return cache->misses;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file     lru_cache.h
+ *
+ * @brief    The Implementation of Least Recently Used Cache.
+ * @author   Hassan Tarek
+ */
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "hash.h"
+#include "list.h"
+
+/* Struct type declaration */
+struct lru_cache;
+
+/* Typedefs */
+typedef struct lru_cache lru_cache;
+
+/**
+ * Define the struct represent the least recently used cache with fixed size keys and values.
+ *
+ * The entries are list nodes holding the key followed by the value, the most
+ * recently used at the head. An open addressing index maps a key to its node,
+ * so a hit moves its node to the head by relinking and a full cache reuses
+ * the tail node for the new entry, neither of which allocates.
+ */
+struct lru_cache {
+    list entries;
+    node** index;
+    size_t index_mask;
+    size_t capacity;
+    size_t key_size;
+    size_t value_size;
+    size_t value_offset;
+    byte* scratch;
+    size_t hits;
+    size_t misses;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void lru_cache_init(lru_cache* cache, size_t key_size, size_t value_size, size_t capacity);
+
+/* Accessing */
+void* lru_cache_get(lru_cache* cache, const void* key);
+void* lru_cache_peek(const lru_cache* cache, const void* key);
+bool lru_cache_contains(const lru_cache* cache, const void* key);
+
+/* Insertion */
+void lru_cache_put(lru_cache* cache, const void* key, const void* value);
+
+/* Removal */
+bool lru_cache_remove(lru_cache* cache, const void* key);
+void lru_cache_clear(lru_cache* cache);
+
+/* Utility */
+size_t lru_cache_size(const lru_cache* cache);
+size_t lru_cache_capacity(const lru_cache* cache);
+bool lru_cache_is_empty(const lru_cache* cache);
+size_t lru_cache_hits(const lru_cache* cache);
+size_t lru_cache_misses(const lru_cache* cache);
+
+
+/* M A C R O S */
+
+#define lru_cache_key(cache_ptr, node_ptr) ((void *) (node_ptr)->val)
+#define lru_cache_value(cache_ptr, node_ptr) ((void *) ((node_ptr)->val + (cache_ptr)->value_offset))
+
+#define lru_cache_for_each(node_ptr, cache_ptr)          \
+    for (node* node_ptr = (cache_ptr)->entries.head;     \
+         node_ptr != NULL;                               \
+         node_ptr = (node_ptr)->next)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LRU_CACHE_H */
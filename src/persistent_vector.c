@@ -0,0 +1,454 @@
+#include "persistent_vector.h"
+
+/**
+ * @brief Retrieves the child pointers of the specified internal node.
+ *
+ * @param node The internal node.
+ *
+ * @return The array of the child pointers.
+ */
+static persistent_vector_node** persistent_vector_children(const persistent_vector_node* node) {
+    return (persistent_vector_node **) node->data;
+}
+
+/**
+ * @brief Create a new leaf node able to hold a full chunk of elements.
+ *
+ * @param element_size The size in bytes of each element.
+ *
+ * @return A pointer to the newly created leaf.
+ */
+static persistent_vector_node* persistent_vector_create_leaf(size_t element_size) {
+    persistent_vector_node* node_ptr = (persistent_vector_node *) malloc(
+            sizeof(persistent_vector_node) + sizeof(byte) * PERSISTENT_VECTOR_BRANCHING * element_size);
+    node_ptr->ref_count = 1;
+    return node_ptr;
+}
+
+/**
+ * @brief Create a new internal node with no children.
+ *
+ * @return A pointer to the newly created internal node.
+ */
+static persistent_vector_node* persistent_vector_create_internal() {
+    size_t children_size = sizeof(persistent_vector_node *) * PERSISTENT_VECTOR_BRANCHING;
+    persistent_vector_node* node_ptr = (persistent_vector_node *) malloc(
+            sizeof(persistent_vector_node) + children_size);
+    node_ptr->ref_count = 1;
+    memset(node_ptr->data, 0, children_size);
+    return node_ptr;
+}
+
+/**
+ * @brief Adds a reference to the specified node.
+ *
+ * @param node The node to be shared, may be NULL.
+ *
+ * @return The same node.
+ */
+static persistent_vector_node* persistent_vector_retain(persistent_vector_node* node) {
+    if (node != NULL) {
+        node->ref_count++;
+    }
+    return node;
+}
+
+/**
+ * @brief Drops a reference to the specified node and frees it with its subtree once unused.
+ *
+ * @param node The node to be released, may be NULL.
+ * @param level The level of the node, zero for leaves.
+ */
+static void persistent_vector_release(persistent_vector_node* node, size_t level) {
+    if (node == NULL || --node->ref_count > 0) {
+        return;
+    }
+    if (level > 0) {
+        persistent_vector_node** children = persistent_vector_children(node);
+        for (size_t i = 0; i < PERSISTENT_VECTOR_BRANCHING; i++) {
+            persistent_vector_release(children[i], level - PERSISTENT_VECTOR_BITS);
+        }
+    }
+    free(node);
+}
+
+/**
+ * @brief Create a copy of the specified internal node sharing all of its children.
+ *
+ * @param node The internal node to be copied.
+ *
+ * @return A pointer to the new internal node.
+ */
+static persistent_vector_node* persistent_vector_copy_internal(const persistent_vector_node* node) {
+    persistent_vector_node* node_ptr = persistent_vector_create_internal();
+    persistent_vector_node** children = persistent_vector_children(node_ptr);
+    memcpy(children, persistent_vector_children(node),
+           sizeof(persistent_vector_node *) * PERSISTENT_VECTOR_BRANCHING);
+    for (size_t i = 0; i < PERSISTENT_VECTOR_BRANCHING; i++) {
+        persistent_vector_retain(children[i]);
+    }
+    return node_ptr;
+}
+
+/**
+ * @brief Create a copy of the first elements of the specified leaf.
+ *
+ * @param node The leaf to be copied, may be NULL when count is zero.
+ * @param count The number of elements to be copied.
+ * @param element_size The size in bytes of each element.
+ *
+ * @return A pointer to the new leaf.
+ */
+static persistent_vector_node* persistent_vector_copy_leaf(const persistent_vector_node* node, size_t count,
+                                                           size_t element_size) {
+    persistent_vector_node* node_ptr = persistent_vector_create_leaf(element_size);
+    if (count > 0) {
+        memcpy(node_ptr->data, node->data, sizeof(byte) * count * element_size);
+    }
+    return node_ptr;
+}
+
+/**
+ * @brief Gets the index of the first element stored in the tail.
+ *
+ * @param size The number of elements in the vector.
+ *
+ * @return The tail offset.
+ */
+static size_t persistent_vector_tail_offset(size_t size) {
+    if (size < PERSISTENT_VECTOR_BRANCHING) {
+        return 0;
+    }
+    return ((size - 1) >> PERSISTENT_VECTOR_BITS) << PERSISTENT_VECTOR_BITS;
+}
+
+/**
+ * @brief Retrieves the leaf holding the specified index from the trie.
+ *
+ * @param vector The vector to be searched.
+ * @param index The index of the element, must be before the tail offset.
+ *
+ * @return The leaf holding the element.
+ */
+static persistent_vector_node* persistent_vector_leaf_for(const persistent_vector* vector, size_t index) {
+    persistent_vector_node* node_ptr = vector->root;
+    for (size_t level = vector->shift; level > 0; level -= PERSISTENT_VECTOR_BITS) {
+        node_ptr = persistent_vector_children(node_ptr)[(index >> level) & PERSISTENT_VECTOR_MASK];
+    }
+    return node_ptr;
+}
+
+/**
+ * @brief Builds a chain of internal nodes down to the specified leaf.
+ *
+ * @param level The level of the top of the chain.
+ * @param leaf The leaf at the bottom of the chain.
+ *
+ * @return The top of the chain.
+ */
+static persistent_vector_node* persistent_vector_new_path(size_t level, persistent_vector_node* leaf) {
+    if (level == 0) {
+        return persistent_vector_retain(leaf);
+    }
+    persistent_vector_node* node_ptr = persistent_vector_create_internal();
+    persistent_vector_children(node_ptr)[0] = persistent_vector_new_path(level - PERSISTENT_VECTOR_BITS, leaf);
+    return node_ptr;
+}
+
+/**
+ * @brief Copies the path to the last leaf and appends the full tail there.
+ *
+ * @param size The number of elements in the vector before the push.
+ * @param level The level of the specified parent.
+ * @param parent The node to copy, may be NULL.
+ * @param tail The full tail to be appended.
+ *
+ * @return The copied node.
+ */
+static persistent_vector_node* persistent_vector_push_tail(size_t size, size_t level,
+                                                           const persistent_vector_node* parent,
+                                                           persistent_vector_node* tail) {
+    persistent_vector_node* node_ptr = parent != NULL ? persistent_vector_copy_internal(parent)
+                                                      : persistent_vector_create_internal();
+    persistent_vector_node** children = persistent_vector_children(node_ptr);
+    size_t sub_index = ((size - 1) >> level) & PERSISTENT_VECTOR_MASK;
+    persistent_vector_node* child = children[sub_index];
+    persistent_vector_node* insert;
+    if (level == PERSISTENT_VECTOR_BITS) {
+        insert = persistent_vector_retain(tail);
+    }
+    else if (child != NULL) {
+        insert = persistent_vector_push_tail(size, level - PERSISTENT_VECTOR_BITS, child, tail);
+    }
+    else {
+        insert = persistent_vector_new_path(level - PERSISTENT_VECTOR_BITS, tail);
+    }
+    persistent_vector_release(child, level - PERSISTENT_VECTOR_BITS);
+    children[sub_index] = insert;
+    return node_ptr;
+}
+
+/**
+ * @brief Copies the path to the leaf holding the specified index and sets the value there.
+ *
+ * @param level The level of the specified node.
+ * @param node The node to copy.
+ * @param index The index of the element.
+ * @param val The new value of the element.
+ * @param element_size The size in bytes of each element.
+ *
+ * @return The copied node.
+ */
+static persistent_vector_node* persistent_vector_assoc(size_t level, const persistent_vector_node* node,
+                                                       size_t index, const void* val, size_t element_size) {
+    if (level == 0) {
+        persistent_vector_node* leaf = persistent_vector_copy_leaf(node, PERSISTENT_VECTOR_BRANCHING, element_size);
+        memcpy(leaf->data + (index & PERSISTENT_VECTOR_MASK) * element_size, val, sizeof(byte) * element_size);
+        return leaf;
+    }
+    persistent_vector_node* node_ptr = persistent_vector_copy_internal(node);
+    persistent_vector_node** children = persistent_vector_children(node_ptr);
+    size_t sub_index = (index >> level) & PERSISTENT_VECTOR_MASK;
+    persistent_vector_node* child = children[sub_index];
+    children[sub_index] = persistent_vector_assoc(level - PERSISTENT_VECTOR_BITS, child, index, val, element_size);
+    persistent_vector_release(child, level - PERSISTENT_VECTOR_BITS);
+    return node_ptr;
+}
+
+/**
+ * @brief Copies the path to the last leaf and drops that leaf.
+ *
+ * @param size The number of elements in the vector before the pop.
+ * @param level The level of the specified node.
+ * @param node The node to copy.
+ *
+ * @return The copied node or NULL if it became empty.
+ */
+static persistent_vector_node* persistent_vector_pop_tail(size_t size, size_t level,
+                                                          const persistent_vector_node* node) {
+    size_t sub_index = ((size - 2) >> level) & PERSISTENT_VECTOR_MASK;
+    persistent_vector_node* new_child = NULL;
+    if (level > PERSISTENT_VECTOR_BITS) {
+        new_child = persistent_vector_pop_tail(size, level - PERSISTENT_VECTOR_BITS,
+                                               persistent_vector_children(node)[sub_index]);
+    }
+    if (new_child == NULL && sub_index == 0) {
+        return NULL;
+    }
+    persistent_vector_node* node_ptr = persistent_vector_copy_internal(node);
+    persistent_vector_node** children = persistent_vector_children(node_ptr);
+    persistent_vector_release(children[sub_index], level - PERSISTENT_VECTOR_BITS);
+    children[sub_index] = new_child;
+    return node_ptr;
+}
+
+/**
+ * @brief Initialize the persistent vector as an empty version.
+ *
+ * @param vector The persistent vector to be initialized.
+ * @param element_size The size in bytes of each element in the vector.
+ */
+void persistent_vector_init(persistent_vector* vector, size_t element_size) {
+    assert(vector != NULL && element_size > 0);
+
+    vector->root = NULL;
+    vector->tail = NULL;
+    vector->size = 0;
+    vector->shift = PERSISTENT_VECTOR_BITS;
+    vector->element_size = element_size;
+}
+
+/**
+ * @brief Takes an O(1) snapshot of the specified version, both share all the nodes.
+ *
+ * @param src The version to be copied.
+ * @param dest The version to be initialized as a copy.
+ */
+void persistent_vector_copy(const persistent_vector* src, persistent_vector* dest) {
+    assert(src != NULL && dest != NULL && src != dest);
+
+    dest->root = persistent_vector_retain(src->root);
+    dest->tail = persistent_vector_retain(src->tail);
+    dest->size = src->size;
+    dest->shift = src->shift;
+    dest->element_size = src->element_size;
+}
+
+/**
+ * @brief Copies the element data at the specified index to a pre-allocated memory block.
+ *
+ * @param vector The version from which the element will be retrieved.
+ * @param index The index of the wanted element.
+ * @param dest A pointer to the memory location where the element will be stored.
+ */
+void persistent_vector_at(const persistent_vector* vector, size_t index, void* dest) {
+    assert(vector != NULL && index < vector->size && dest != NULL);
+
+    const persistent_vector_node* leaf = index >= persistent_vector_tail_offset(vector->size)
+                                         ? vector->tail
+                                         : persistent_vector_leaf_for(vector, index);
+    memcpy(dest, leaf->data + (index & PERSISTENT_VECTOR_MASK) * vector->element_size,
+           sizeof(byte) * vector->element_size);
+}
+
+/**
+ * @brief Builds a new version with the specified value appended, in O(log32 n).
+ *
+ * @param src The version to append to, it is left unchanged.
+ * @param val The value to be appended.
+ * @param dest The version to be initialized with the result.
+ */
+void persistent_vector_push_back(const persistent_vector* src, const void* val, persistent_vector* dest) {
+    assert(src != NULL && val != NULL && dest != NULL && src != dest);
+
+    size_t tail_count = src->size - persistent_vector_tail_offset(src->size);
+    persistent_vector_node* root;
+    persistent_vector_node* tail;
+    size_t shift = src->shift;
+    if (tail_count < PERSISTENT_VECTOR_BRANCHING) {
+        root = persistent_vector_retain(src->root);
+        tail = persistent_vector_copy_leaf(src->tail, tail_count, src->element_size);
+        memcpy(tail->data + tail_count * src->element_size, val, sizeof(byte) * src->element_size);
+    }
+    else {
+        if ((src->size >> PERSISTENT_VECTOR_BITS) > ((size_t) 1 << src->shift)) {
+            root = persistent_vector_create_internal();
+            persistent_vector_children(root)[0] = persistent_vector_retain(src->root);
+            persistent_vector_children(root)[1] = persistent_vector_new_path(src->shift, src->tail);
+            shift += PERSISTENT_VECTOR_BITS;
+        }
+        else {
+            root = persistent_vector_push_tail(src->size, src->shift, src->root, src->tail);
+        }
+        tail = persistent_vector_create_leaf(src->element_size);
+        memcpy(tail->data, val, sizeof(byte) * src->element_size);
+    }
+    dest->root = root;
+    dest->tail = tail;
+    dest->size = src->size + 1;
+    dest->shift = shift;
+    dest->element_size = src->element_size;
+}
+
+/**
+ * @brief Builds a new version with the element at the specified index replaced, in O(log32 n).
+ *
+ * @param src The version to update, it is left unchanged.
+ * @param index The index of the element to be replaced.
+ * @param val The new value of the element.
+ * @param dest The version to be initialized with the result.
+ */
+void persistent_vector_set(const persistent_vector* src, size_t index, const void* val, persistent_vector* dest) {
+    assert(src != NULL && index < src->size && val != NULL && dest != NULL && src != dest);
+
+    size_t tail_offset = persistent_vector_tail_offset(src->size);
+    if (index >= tail_offset) {
+        dest->root = persistent_vector_retain(src->root);
+        dest->tail = persistent_vector_copy_leaf(src->tail, src->size - tail_offset, src->element_size);
+        memcpy(dest->tail->data + (index & PERSISTENT_VECTOR_MASK) * src->element_size,
+               val, sizeof(byte) * src->element_size);
+    }
+    else {
+        dest->root = persistent_vector_assoc(src->shift, src->root, index, val, src->element_size);
+        dest->tail = persistent_vector_retain(src->tail);
+    }
+    dest->size = src->size;
+    dest->shift = src->shift;
+    dest->element_size = src->element_size;
+}
+
+/**
+ * @brief Builds a new version without the last element, in O(log32 n).
+ *
+ * @param src The version to remove from, it is left unchanged.
+ * @param dest The version to be initialized with the result.
+ */
+void persistent_vector_pop_back(const persistent_vector* src, persistent_vector* dest) {
+    assert(src != NULL && src->size > 0 && dest != NULL && src != dest);
+
+    size_t tail_count = src->size - persistent_vector_tail_offset(src->size);
+    persistent_vector_init(dest, src->element_size);
+    if (src->size == 1) {
+        return;
+    }
+    dest->size = src->size - 1;
+    dest->shift = src->shift;
+    if (tail_count > 1) {
+        dest->root = persistent_vector_retain(src->root);
+        dest->tail = persistent_vector_copy_leaf(src->tail, tail_count - 1, src->element_size);
+        return;
+    }
+    dest->tail = persistent_vector_retain(persistent_vector_leaf_for(src, src->size - 2));
+    dest->root = persistent_vector_pop_tail(src->size, src->shift, src->root);
+    if (dest->root != NULL && dest->shift > PERSISTENT_VECTOR_BITS &&
+        persistent_vector_children(dest->root)[1] == NULL) {
+        persistent_vector_node* root = persistent_vector_retain(persistent_vector_children(dest->root)[0]);
+        persistent_vector_release(dest->root, dest->shift);
+        dest->root = root;
+        dest->shift -= PERSISTENT_VECTOR_BITS;
+    }
+}
+
+/**
+ * @brief Releases the specified version, the nodes no other version uses are freed.
+ *
+ * @param vector A pointer to the version to be released.
+ */
+void persistent_vector_destroy(persistent_vector* vector) {
+    assert(vector != NULL);
+
+    persistent_vector_release(vector->root, vector->shift);
+    persistent_vector_release(vector->tail, 0);
+    vector->root = NULL;
+    vector->tail = NULL;
+    vector->size = 0;
+    vector->shift = PERSISTENT_VECTOR_BITS;
+}
+
+/**
+ * @brief Gets the size of the specified version.
+ *
+ * @param vector The version whose size will be returned.
+ *
+ * @return The size of the specified version.
+ */
+size_t persistent_vector_size(const persistent_vector* vector) {
+    assert(vector != NULL);
+
+    return vector->size;
+}
+
+/**
+ * @brief Checks whether the version is empty or not.
+ *
+ * @param vector The version to be checked.
+ *
+ * @return Whether or not the version is empty.
+ */
+bool persistent_vector_is_empty(const persistent_vector* vector) {
+    assert(vector != NULL);
+
+    return vector->size == 0;
+}
+
+/**
+ * @brief Copies the version elements to the specified array, a whole leaf at a time.
+ *
+ * @param vector The version whose elements will be copied to the specified array.
+ * @param array The array where the elements will be copied.
+ */
+void persistent_vector_copy_to_array(const persistent_vector* vector, void* array) {
+    assert(vector != NULL && array != NULL);
+
+    byte* dest = (byte *) array;
+    size_t tail_offset = persistent_vector_tail_offset(vector->size);
+    size_t chunk_size = PERSISTENT_VECTOR_BRANCHING * vector->element_size;
+    for (size_t index = 0; index < tail_offset; index += PERSISTENT_VECTOR_BRANCHING) {
+        memcpy(dest + index * vector->element_size,
+               persistent_vector_leaf_for(vector, index)->data, sizeof(byte) * chunk_size);
+    }
+    if (vector->size > tail_offset) {
+        memcpy(dest + tail_offset * vector->element_size, vector->tail->data,
+               sizeof(byte) * (vector->size - tail_offset) * vector->element_size);
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file     persistent_vector.h
+ *
+ * @brief    The Implementation of the Persistent Vector.
+ * @author   Hassan Tarek
+ */
+
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct persistent_vector_node;
+struct persistent_vector;
+
+/* Typedefs */
+typedef struct persistent_vector_node persistent_vector_node;
+typedef struct persistent_vector persistent_vector;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent a reference counted trie node.
+ * Internal nodes hold child pointers and leaves hold the elements.
+ */
+struct persistent_vector_node {
+    size_t ref_count;
+    _Alignas(max_align_t) byte data[];
+};
+
+/**
+ * Define the struct represent one version of the persistent vector.
+ * Versions never change once built, updates produce new versions
+ * which share all the untouched nodes.
+ */
+struct persistent_vector {
+    persistent_vector_node* root;
+    persistent_vector_node* tail;
+    size_t size;
+    size_t shift;
+    size_t element_size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void persistent_vector_init(persistent_vector* vector, size_t element_size);
+void persistent_vector_copy(const persistent_vector* src, persistent_vector* dest);
+
+/* Accessing */
+void persistent_vector_at(const persistent_vector* vector, size_t index, void* dest);
+
+/* Updating */
+void persistent_vector_push_back(const persistent_vector* src, const void* val, persistent_vector* dest);
+void persistent_vector_set(const persistent_vector* src, size_t index, const void* val, persistent_vector* dest);
+void persistent_vector_pop_back(const persistent_vector* src, persistent_vector* dest);
+
+/* Removal */
+void persistent_vector_destroy(persistent_vector* vector);
+
+/* Utility */
+size_t persistent_vector_size(const persistent_vector* vector);
+bool persistent_vector_is_empty(const persistent_vector* vector);
+void persistent_vector_copy_to_array(const persistent_vector* vector, void* array);
+
+
+/* M A C R O S */
+
+#define PERSISTENT_VECTOR_BITS 5
+#define PERSISTENT_VECTOR_BRANCHING (1 << PERSISTENT_VECTOR_BITS)
+#define PERSISTENT_VECTOR_MASK (PERSISTENT_VECTOR_BRANCHING - 1)
+
+#define persistent_vector_for_each(index, vector_ptr) \
+    for (size_t index = 0;                            \
+         index < (vector_ptr)->size;                  \
+         ++index)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PERSISTENT_VECTOR_H */
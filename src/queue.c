@@ -50,8 +50,7 @@ node* queue_front(const queue* queue) {
 void queue_push(queue* queue, const void* val) {
     assert(queue != NULL && val != NULL);
 
-    node* node_ptr = (node *) malloc(sizeof(node));
-    node_ptr->val = (byte *) malloc(sizeof(byte) * queue->element_size);
+    node* node_ptr = (node *) malloc(sizeof(node) + sizeof(byte) * queue->element_size);
     node_ptr->next = NULL;
     memcpy(node_ptr->val, val, sizeof(byte) * queue->element_size);
 
@@ -79,8 +78,6 @@ void queue_pop(queue* queue) {
     queue->head = queue->head->next;
     node_ptr->next = NULL;
     queue->size--;
-    free(node_ptr->val);
-    node_ptr->val = NULL;
     free(node_ptr);
     node_ptr = NULL;
 }
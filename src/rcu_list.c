@@ -0,0 +1,433 @@
+#include "rcu_list.h"
+
+/**
+ * @brief Create a new unlinked node holding a copy of the specified value.
+ *
+ * @param list The list the node belongs to.
+ * @param val The value of the node.
+ *
+ * @return A pointer to the newly created node.
+ */
+static rcu_node* rcu_list_create_node(const rcu_list* list, const void* val) {
+    rcu_node* node = (rcu_node *) malloc(sizeof(rcu_node) + sizeof(byte) * list->element_size);
+    atomic_init(&node->next, (rcu_node *) NULL);
+    node->retired_next = NULL;
+    node->retired_epoch = 0;
+    memcpy(node->val, val, list->element_size);
+    return node;
+}
+
+/**
+ * @brief Gets the oldest epoch a reader is still reading in, or the next epoch when none is reading.
+ *        The writer lock must be held.
+ *
+ * @param list The list whose readers will be checked.
+ *
+ * @return The oldest epoch in use.
+ */
+static size_t rcu_list_oldest_epoch(rcu_list* list) {
+    size_t oldest = atomic_load(&list->epoch);
+    for (rcu_list_reader* reader = list->readers; reader != NULL; reader = reader->next) {
+        size_t epoch = atomic_load(&reader->epoch);
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    return oldest;
+}
+
+/**
+ * @brief Frees the retired nodes no reader can still reach. The writer lock must be held.
+ *
+ * @param list The list whose retired nodes will be freed.
+ */
+static void rcu_list_reclaim(rcu_list* list) {
+    size_t oldest = rcu_list_oldest_epoch(list);
+    while (list->retired_head != NULL && list->retired_head->retired_epoch < oldest) {
+        rcu_node* node = list->retired_head;
+        list->retired_head = node->retired_next;
+        free(node);
+        list->retired_size--;
+    }
+    if (list->retired_head == NULL) {
+        list->retired_tail = NULL;
+    }
+}
+
+/**
+ * @brief Unlinks the node following the specified link and retires it. The writer lock must be held.
+ *
+ * @param list The list to remove from.
+ * @param prev The node before the removed one, or NULL to remove the head.
+ * @param node The node to be removed.
+ */
+static void rcu_list_unlink(rcu_list* list, rcu_node* prev, rcu_node* node) {
+    rcu_node* next = atomic_load_explicit(&node->next, memory_order_relaxed);
+    if (prev != NULL)
+        atomic_store_explicit(&prev->next, next, memory_order_release);
+    else
+        atomic_store_explicit(&list->head, next, memory_order_release);
+    if (node == list->tail) {
+        list->tail = prev;
+    }
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+    node->retired_epoch = atomic_fetch_add(&list->epoch, 1);
+    if (list->retired_tail != NULL)
+        list->retired_tail->retired_next = node;
+    else
+        list->retired_head = node;
+    list->retired_tail = node;
+    list->retired_size++;
+    if (list->retired_size >= RCU_LIST_RECLAIM_THRESHOLD) {
+        rcu_list_reclaim(list);
+    }
+}
+
+/**
+ * @brief Links a new node holding the value after the specified node. The writer lock must be held.
+ *
+ * @param list The list to add to.
+ * @param prev The node which will precede the new node, or NULL to add at the front.
+ * @param val The value to be added.
+ */
+static void rcu_list_link_after(rcu_list* list, rcu_node* prev, const void* val) {
+    rcu_node* node = rcu_list_create_node(list, val);
+    _Atomic(rcu_node *)* link = prev != NULL ? &prev->next : &list->head;
+    atomic_init(&node->next, atomic_load_explicit(link, memory_order_relaxed));
+    atomic_store_explicit(link, node, memory_order_release);
+    if (prev == list->tail) {
+        list->tail = node;
+    }
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Finds the node at the specified index. The writer lock must be held.
+ */
+static rcu_node* rcu_list_node_at(rcu_list* list, size_t index) {
+    rcu_node* node = atomic_load_explicit(&list->head, memory_order_relaxed);
+    for (size_t i = 0; i < index; i++) {
+        node = atomic_load_explicit(&node->next, memory_order_relaxed);
+    }
+    return node;
+}
+
+/**
+ * @brief Initialize the RCU list.
+ *
+ * @param list The list to be initialized.
+ * @param element_size The size in bytes of each element in the list.
+ */
+void rcu_list_init(rcu_list* list, size_t element_size) {
+    assert(list != NULL && element_size > 0);
+
+    atomic_init(&list->head, (rcu_node *) NULL);
+    list->tail = NULL;
+    atomic_init(&list->size, (size_t) 0);
+    list->element_size = element_size;
+    atomic_init(&list->epoch, (size_t) 1);
+    list->readers = NULL;
+    list->retired_head = NULL;
+    list->retired_tail = NULL;
+    list->retired_size = 0;
+    pthread_mutex_init(&list->writer_lock, NULL);
+}
+
+/**
+ * @brief Registers a new reader of the list, each reading thread needs its own.
+ *
+ * @param list The list to be read.
+ *
+ * @return The reader to be passed to rcu_list_read_lock and rcu_list_read_unlock.
+ */
+rcu_list_reader* rcu_list_register(rcu_list* list) {
+    assert(list != NULL);
+
+    rcu_list_reader* reader = (rcu_list_reader *) malloc(sizeof(rcu_list_reader));
+    atomic_init(&reader->epoch, (size_t) 0);
+    pthread_mutex_lock(&list->writer_lock);
+    reader->next = list->readers;
+    list->readers = reader;
+    pthread_mutex_unlock(&list->writer_lock);
+    return reader;
+}
+
+/**
+ * @brief Unregisters and frees the specified reader, it must be outside of its read section.
+ *
+ * @param list The list the reader was registered to.
+ * @param reader The reader to be unregistered.
+ */
+void rcu_list_unregister(rcu_list* list, rcu_list_reader* reader) {
+    assert(list != NULL && reader != NULL && atomic_load(&reader->epoch) == 0);
+
+    pthread_mutex_lock(&list->writer_lock);
+    rcu_list_reader** link = &list->readers;
+    while (*link != reader) {
+        link = &(*link)->next;
+    }
+    *link = reader->next;
+    pthread_mutex_unlock(&list->writer_lock);
+    free(reader);
+}
+
+/**
+ * @brief Enters a read section, the nodes reached until rcu_list_read_unlock stay valid.
+ *        It only stores to the line of the reader, no lock or atomic read-modify-write is used.
+ *
+ * @param list The list to be read.
+ * @param reader The reader of the calling thread.
+ */
+void rcu_list_read_lock(rcu_list* list, rcu_list_reader* reader) {
+    assert(list != NULL && reader != NULL);
+
+    atomic_store_explicit(&reader->epoch, atomic_load_explicit(&list->epoch, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief Leaves the read section of the reader.
+ *
+ * @param reader The reader of the calling thread.
+ */
+void rcu_list_read_unlock(rcu_list_reader* reader) {
+    assert(reader != NULL);
+
+    atomic_store_explicit(&reader->epoch, (size_t) 0, memory_order_release);
+}
+
+/**
+ * @brief Retrieves the first element of the list, inside a read section.
+ *
+ * @param list The list whose first element wanted to be retrieved.
+ *
+ * @return A pointer to the first element or NULL if the list is empty.
+ */
+void* rcu_list_front(const rcu_list* list) {
+    assert(list != NULL);
+
+    rcu_node* head = atomic_load_explicit((_Atomic(rcu_node *) *) &list->head, memory_order_acquire);
+    return head != NULL ? head->val : NULL;
+}
+
+/**
+ * @brief Retrieves the index of the specified value or -1 if it's not found, inside a read section.
+ *
+ * @param list The list to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int rcu_list_index_of(const rcu_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    int index = 0;
+    rcu_list_for_each(node, (rcu_list *) list) {
+        if (memcmp(node->val, val, list->element_size) == 0) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Checks whether the list holds the specified value, inside a read section.
+ *
+ * @param list The list to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return Whether or not the value is in the list.
+ */
+bool rcu_list_contains(const rcu_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    return rcu_list_index_of(list, val) != -1;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void rcu_list_push_back(rcu_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    rcu_list_link_after(list, list->tail, val);
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Insert a copy of the specified value into the front of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void rcu_list_push_front(rcu_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    rcu_list_link_after(list, NULL, val);
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Insert a copy of the specified value at the specified index.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ * @param index The index at which the value will be added, at most the size.
+ */
+void rcu_list_insert_at(rcu_list* list, const void* val, size_t index) {
+    assert(list != NULL && val != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    assert(index <= atomic_load(&list->size));
+    rcu_list_link_after(list, index > 0 ? rcu_list_node_at(list, index - 1) : NULL, val);
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Remove the first element from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void rcu_list_pop_front(rcu_list* list) {
+    assert(list != NULL);
+
+    rcu_list_remove_at(list, 0);
+}
+
+/**
+ * @brief Remove the element at the specified index, its node is freed once no reader can reach it.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param index The index of the element to be removed.
+ */
+void rcu_list_remove_at(rcu_list* list, size_t index) {
+    assert(list != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    assert(index < atomic_load(&list->size));
+    rcu_node* prev = index > 0 ? rcu_list_node_at(list, index - 1) : NULL;
+    rcu_list_unlink(list, prev, prev != NULL ? atomic_load(&prev->next) : atomic_load(&list->head));
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Remove all occurrences of the specified value from the list.
+ *
+ * @param list A pointer to a list to remove from.
+ * @param val A pointer to the value to be removed from the list.
+ */
+void rcu_list_remove(rcu_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    rcu_node* prev = NULL;
+    rcu_node* cur = atomic_load_explicit(&list->head, memory_order_relaxed);
+    while (cur != NULL) {
+        rcu_node* next = atomic_load_explicit(&cur->next, memory_order_relaxed);
+        if (memcmp(cur->val, val, list->element_size) == 0)
+            rcu_list_unlink(list, prev, cur);
+        else
+            prev = cur;
+        cur = next;
+    }
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Waits until every reader has left the read sections it was in, then frees all the retired nodes.
+ *        It must not be called inside a read section.
+ *
+ * @param list The list whose retired nodes will be freed.
+ */
+void rcu_list_synchronize(rcu_list* list) {
+    assert(list != NULL);
+
+    pthread_mutex_lock(&list->writer_lock);
+    size_t epoch = atomic_fetch_add(&list->epoch, 1);
+    while (rcu_list_oldest_epoch(list) <= epoch) {
+        pthread_mutex_unlock(&list->writer_lock);
+        sched_yield();
+        pthread_mutex_lock(&list->writer_lock);
+    }
+    rcu_list_reclaim(list);
+    pthread_mutex_unlock(&list->writer_lock);
+}
+
+/**
+ * @brief Frees the nodes and the readers of the list, no thread may access it anymore.
+ *
+ * @param list A pointer to the list to free from.
+ */
+void rcu_list_destroy(rcu_list* list) {
+    assert(list != NULL);
+
+    rcu_node* node = atomic_load(&list->head);
+    while (node != NULL) {
+        rcu_node* next = atomic_load(&node->next);
+        free(node);
+        node = next;
+    }
+    while (list->retired_head != NULL) {
+        node = list->retired_head;
+        list->retired_head = node->retired_next;
+        free(node);
+    }
+    while (list->readers != NULL) {
+        rcu_list_reader* next = list->readers->next;
+        free(list->readers);
+        list->readers = next;
+    }
+    atomic_store(&list->head, (rcu_node *) NULL);
+    atomic_store(&list->size, (size_t) 0);
+    list->tail = NULL;
+    list->retired_tail = NULL;
+    list->retired_size = 0;
+    pthread_mutex_destroy(&list->writer_lock);
+}
+
+/**
+ * @brief Gets the number of elements in the specified list.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The number of elements in the list.
+ */
+size_t rcu_list_size(const rcu_list* list) {
+    assert(list != NULL);
+
+    return atomic_load_explicit((atomic_size_t *) &list->size, memory_order_relaxed);
+}
+
+/**
+ * @brief Checks whether the list is empty or not.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool rcu_list_is_empty(const rcu_list* list) {
+    assert(list != NULL);
+
+    return rcu_list_size(list) == 0;
+}
+
+/**
+ * @brief Gets the number of removed nodes waiting for the readers before being freed.
+ *
+ * @param list The list whose retired nodes will be counted.
+ *
+ * @return The number of retired nodes.
+ */
+size_t rcu_list_retired_size(const rcu_list* list) {
+    assert(list != NULL);
+
+    return list->retired_size;
+}
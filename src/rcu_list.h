@@ -0,0 +1,128 @@
+/**
+ * @file     rcu_list.h
+ *
+ * @brief    The Implementation of Read-Copy-Update Linked List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef RCU_LIST_H
+#define RCU_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct rcu_node;
+struct rcu_list_reader;
+struct rcu_list;
+
+/* Typedefs */
+typedef struct rcu_node rcu_node;
+typedef struct rcu_list_reader rcu_list_reader;
+typedef struct rcu_list rcu_list;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the node that make RCU list.
+ *
+ * Readers only follow next, which the writer publishes with release stores.
+ * An unlinked node keeps its next so a reader standing on it can go on, and
+ * is chained through retired_next with the epoch it was retired in.
+ */
+struct rcu_node {
+    _Atomic(rcu_node *) next;
+    rcu_node* retired_next;
+    size_t retired_epoch;
+    _Alignas(max_align_t) byte val[];
+};
+
+/**
+ * Define the struct represent a registered reader of the list, epoch is the
+ * list epoch the reader entered its read section in, or 0 outside of it.
+ */
+struct rcu_list_reader {
+    rcu_list_reader* next;
+    _Atomic size_t epoch;
+};
+
+/**
+ * Define the struct represent the singly linked list with lock-free readers.
+ *
+ * Readers traverse between rcu_list_read_lock and rcu_list_read_unlock with
+ * plain loads and stores, they never block and never write shared lines the
+ * writers read often. Writers are serialized by a mutex, unlink the removed
+ * nodes and retire them in the current epoch, then bump the epoch. A node
+ * retired in epoch e is freed once every reader is outside its read section
+ * or entered it in an epoch after e.
+ */
+struct rcu_list {
+    _Atomic(rcu_node *) head;
+    rcu_node* tail;
+    atomic_size_t size;
+    size_t element_size;
+    _Atomic size_t epoch;
+    rcu_list_reader* readers;
+    rcu_node* retired_head;
+    rcu_node* retired_tail;
+    size_t retired_size;
+    pthread_mutex_t writer_lock;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void rcu_list_init(rcu_list* list, size_t element_size);
+rcu_list_reader* rcu_list_register(rcu_list* list);
+void rcu_list_unregister(rcu_list* list, rcu_list_reader* reader);
+
+/* Reading */
+void rcu_list_read_lock(rcu_list* list, rcu_list_reader* reader);
+void rcu_list_read_unlock(rcu_list_reader* reader);
+void* rcu_list_front(const rcu_list* list);
+int rcu_list_index_of(const rcu_list* list, const void* val);
+bool rcu_list_contains(const rcu_list* list, const void* val);
+
+/* Insertion */
+void rcu_list_push_back(rcu_list* list, const void* val);
+void rcu_list_push_front(rcu_list* list, const void* val);
+void rcu_list_insert_at(rcu_list* list, const void* val, size_t index);
+
+/* Removal */
+void rcu_list_pop_front(rcu_list* list);
+void rcu_list_remove_at(rcu_list* list, size_t index);
+void rcu_list_remove(rcu_list* list, const void* val);
+void rcu_list_synchronize(rcu_list* list);
+void rcu_list_destroy(rcu_list* list);
+
+/* Utility */
+size_t rcu_list_size(const rcu_list* list);
+bool rcu_list_is_empty(const rcu_list* list);
+size_t rcu_list_retired_size(const rcu_list* list);
+
+
+/* M A C R O S */
+
+#define RCU_LIST_RECLAIM_THRESHOLD 64
+
+#define rcu_list_for_each(node_ptr, list_ptr)                                             \
+    for (rcu_node* node_ptr = atomic_load_explicit(&(list_ptr)->head, memory_order_acquire); \
+         node_ptr != NULL;                                                                \
+         node_ptr = atomic_load_explicit(&(node_ptr)->next, memory_order_acquire))
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RCU_LIST_H */
@@ -0,0 +1,198 @@
+#include "ring_queue.h"
+
+/**
+ * @brief Gets the address of the slot holding the element at the specified offset from the front.
+ */
+static byte* ring_queue_slot(const ring_queue* queue, size_t index) {
+    return queue->data + ((queue->head + index) & (queue->capacity - 1)) * queue->element_size;
+}
+
+/**
+ * @brief Initialize the ring queue.
+ *
+ * @param queue The queue to be initialized.
+ * @param element_size The size in bytes of each element in the queue.
+ */
+void ring_queue_init(ring_queue* queue, size_t element_size) {
+    assert(queue != NULL && element_size > 0);
+
+    queue->data = (byte *) malloc(sizeof(byte) * RING_QUEUE_INIT_CAPACITY * element_size);
+    queue->head = 0;
+    queue->size = 0;
+    queue->capacity = RING_QUEUE_INIT_CAPACITY;
+    queue->element_size = element_size;
+}
+
+/**
+ * @brief Copies the last element of the queue to a pre-allocated memory block.
+ *
+ * @param queue The queue whose last element will be retrieved, it must not be empty.
+ * @param dest A pointer to the memory location where the element will be stored.
+ */
+void ring_queue_back(const ring_queue* queue, void* dest) {
+    assert(queue != NULL && queue->size > 0 && dest != NULL);
+
+    memcpy(dest, ring_queue_slot(queue, queue->size - 1), queue->element_size);
+}
+
+/**
+ * @brief Copies the first element of the queue to a pre-allocated memory block.
+ *
+ * @param queue The queue whose first element will be retrieved, it must not be empty.
+ * @param dest A pointer to the memory location where the element will be stored.
+ */
+void ring_queue_front(const ring_queue* queue, void* dest) {
+    assert(queue != NULL && queue->size > 0 && dest != NULL);
+
+    memcpy(dest, ring_queue_slot(queue, 0), queue->element_size);
+}
+
+/**
+ * @brief Retrieves the first element of the queue in place, without copying it.
+ *        The pointer is valid until the next push or pop.
+ *
+ * @param queue The queue whose first element will be retrieved.
+ *
+ * @return A pointer to the first element or NULL if the queue is empty.
+ */
+void* ring_queue_front_ptr(const ring_queue* queue) {
+    assert(queue != NULL);
+
+    return queue->size > 0 ? ring_queue_slot(queue, 0) : NULL;
+}
+
+/**
+ * @brief Retrieves the element at the specified offset from the front of the queue in place.
+ *
+ * @param queue The queue whose element will be retrieved.
+ * @param index The offset of the element from the front, less than the size.
+ *
+ * @return A pointer to the element, valid until the next push or pop.
+ */
+void* ring_queue_at(const ring_queue* queue, size_t index) {
+    assert(queue != NULL && index < queue->size);
+
+    return ring_queue_slot(queue, index);
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the queue,
+ *        doubling the buffer when it is full.
+ *
+ * @param queue A pointer to the queue to add to.
+ * @param val The value to be added to the queue.
+ */
+void ring_queue_push(ring_queue* queue, const void* val) {
+    assert(queue != NULL && queue->data != NULL && val != NULL);
+
+    if (queue->size == queue->capacity) {
+        ring_queue_reserve(queue, queue->capacity * 2);
+    }
+    memcpy(ring_queue_slot(queue, queue->size), val, queue->element_size);
+    queue->size++;
+}
+
+/**
+ * @brief Remove the first element from the queue.
+ *
+ * @param queue A pointer to the queue to remove from.
+ */
+void ring_queue_pop(ring_queue* queue) {
+    assert(queue != NULL && queue->size > 0);
+
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+}
+
+/**
+ * @brief Remove all the queue elements, the buffer is kept.
+ *
+ * @param queue A pointer to the queue to remove from.
+ */
+void ring_queue_clear(ring_queue* queue) {
+    assert(queue != NULL);
+
+    queue->head = 0;
+    queue->size = 0;
+}
+
+/**
+ * @brief Frees the memory allocated for the queue buffer.
+ *
+ * @param queue A pointer to the queue to free from.
+ */
+void ring_queue_destroy(ring_queue* queue) {
+    assert(queue != NULL);
+
+    free(queue->data);
+    queue->data = NULL;
+    queue->head = 0;
+    queue->size = 0;
+    queue->capacity = 0;
+}
+
+/**
+ * @brief Gets the number of elements in the specified queue.
+ *
+ * @param queue The queue whose size will be returned.
+ *
+ * @return The number of elements in the queue.
+ */
+size_t ring_queue_size(const ring_queue* queue) {
+    assert(queue != NULL);
+
+    return queue->size;
+}
+
+/**
+ * @brief Gets the number of elements the buffer of the specified queue can hold.
+ *
+ * @param queue The queue whose capacity will be returned.
+ *
+ * @return The capacity of the queue.
+ */
+size_t ring_queue_capacity(const ring_queue* queue) {
+    assert(queue != NULL);
+
+    return queue->capacity;
+}
+
+/**
+ * @brief Checks whether the queue is empty or not.
+ *
+ * @param queue The queue to be checked.
+ *
+ * @return Whether or not the queue is empty.
+ */
+bool ring_queue_is_empty(const ring_queue* queue) {
+    assert(queue != NULL);
+
+    return queue->size == 0;
+}
+
+/**
+ * @brief Grows the buffer to the power of two not less than the specified capacity,
+ *        copying the elements unwrapped to the start of the new buffer.
+ *
+ * @param queue The queue for which we will reserve a space.
+ * @param new_capacity The number of elements the queue should hold without allocating.
+ */
+void ring_queue_reserve(ring_queue* queue, size_t new_capacity) {
+    assert(queue != NULL && queue->data != NULL);
+
+    if (new_capacity <= queue->capacity) {
+        return;
+    }
+    size_t capacity = queue->capacity;
+    while (capacity < new_capacity) {
+        capacity *= 2;
+    }
+    byte* data = (byte *) malloc(sizeof(byte) * capacity * queue->element_size);
+    size_t first = queue->capacity - queue->head < queue->size ? queue->capacity - queue->head : queue->size;
+    memcpy(data, queue->data + queue->head * queue->element_size, first * queue->element_size);
+    memcpy(data + first * queue->element_size, queue->data, (queue->size - first) * queue->element_size);
+    free(queue->data);
+    queue->data = data;
+    queue->head = 0;
+    queue->capacity = capacity;
+}
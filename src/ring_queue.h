@@ -0,0 +1,85 @@
+/**
+ * @file     ring_queue.h
+ *
+ * @brief    The Implementation of Ring Buffer Queue.
+ * @author   Hassan Tarek
+ */
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct ring_queue;
+
+/* Typedefs */
+typedef struct ring_queue ring_queue;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the queue stored in a circular buffer.
+ *
+ * The capacity is a power of two, so the slot of an element is its offset
+ * from head masked by capacity - 1. A full buffer is doubled and unwrapped
+ * to start at head 0, so a queue staying within its capacity pushes and
+ * pops without allocating.
+ */
+struct ring_queue {
+    byte* data;
+    size_t head;
+    size_t size;
+    size_t capacity;
+    size_t element_size;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void ring_queue_init(ring_queue* queue, size_t element_size);
+
+/* Accessing */
+void ring_queue_back(const ring_queue* queue, void* dest);
+void ring_queue_front(const ring_queue* queue, void* dest);
+void* ring_queue_front_ptr(const ring_queue* queue);
+void* ring_queue_at(const ring_queue* queue, size_t index);
+
+/* Insertion */
+void ring_queue_push(ring_queue* queue, const void* val);
+
+/* Removal */
+void ring_queue_pop(ring_queue* queue);
+void ring_queue_clear(ring_queue* queue);
+void ring_queue_destroy(ring_queue* queue);
+
+/* Utility */
+size_t ring_queue_size(const ring_queue* queue);
+size_t ring_queue_capacity(const ring_queue* queue);
+bool ring_queue_is_empty(const ring_queue* queue);
+void ring_queue_reserve(ring_queue* queue, size_t new_capacity);
+
+
+/* M A C R O S */
+
+#define RING_QUEUE_INIT_CAPACITY 16
+
+#define ring_queue_for_each(index, queue_ptr) \
+    for (size_t index = 0;                    \
+         index < (queue_ptr)->size;           \
+         ++index)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RING_QUEUE_H */
@@ -0,0 +1,390 @@
+#include "skip_list.h"
+
+/**
+ * @brief Draws the height of a new node, each extra level has a quarter chance.
+ *
+ * @param list The list holding the random state.
+ *
+ * @return The height between one and SKIP_LIST_MAX_LEVEL.
+ */
+static size_t skip_list_random_height(skip_list* list) {
+    uint64_t x = list->random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    list->random_state = x;
+    size_t height = 1;
+    while (height < SKIP_LIST_MAX_LEVEL && (x & 3) == 0) {
+        height++;
+        x >>= 2;
+    }
+    return height;
+}
+
+/**
+ * @brief Create a new node with its levels in the same allocation.
+ *
+ * @param list The list the node belongs to.
+ * @param val The value of the node.
+ * @param height The number of levels of the node.
+ *
+ * @return A pointer to the newly created node.
+ */
+static skip_list_node* skip_list_create_node(const skip_list* list, const void* val, size_t height) {
+    size_t alignment = _Alignof(max_align_t);
+    size_t val_size = (list->element_size + alignment - 1) / alignment * alignment;
+    skip_list_node* node = (skip_list_node *) malloc(sizeof(skip_list_node) + val_size +
+                                                     sizeof(skip_list_level) * height);
+    node->levels = (skip_list_level *) (node->val + val_size);
+    node->height = height;
+    memcpy(node->val, val, list->element_size);
+    return node;
+}
+
+/**
+ * @brief Finds on every level the last links before the specified position,
+ *        the head is position zero and the element at index i is position i + 1.
+ *
+ * @param list The list to be searched.
+ * @param position The position to stop before.
+ * @param update Receives the levels of the last node before the position on each level.
+ * @param rank Receives the position of those nodes, may be NULL.
+ */
+static void skip_list_find(const skip_list* list, size_t position, skip_list_level** update, size_t* rank) {
+    skip_list_level* levels = (skip_list_level *) list->head;
+    size_t offset = 0;
+    size_t lvl = list->level;
+    do {
+        lvl--;
+        while (levels[lvl].next != NULL && offset + levels[lvl].span < position) {
+            offset += levels[lvl].span;
+            levels = levels[lvl].next->levels;
+        }
+        update[lvl] = levels;
+        if (rank != NULL) {
+            rank[lvl] = offset;
+        }
+    } while (lvl > 0);
+}
+
+/**
+ * @brief Initialize the skip list.
+ *
+ * @param list The list to be initialized.
+ * @param element_size The size in bytes of each element in the list.
+ * @param compare The compare function keeping the list sorted, or NULL for a positional list.
+ */
+void skip_list_init(skip_list* list, size_t element_size, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(list != NULL);
+
+    list->head[0].next = NULL;
+    list->head[0].span = 1;
+    list->level = 1;
+    list->size = 0;
+    list->element_size = element_size;
+    list->random_state = 0x9e3779b97f4a7c15ULL;
+    list->compare = compare;
+}
+
+/**
+ * @brief Retrieves the last node of the specified list.
+ *
+ * @param list The list whose last node wanted to be retrieved.
+ *
+ * @return The last node or NULL if the list is empty.
+ */
+skip_list_node* skip_list_back(const skip_list* list) {
+    assert(list != NULL);
+
+    return list->size > 0 ? skip_list_at(list, list->size - 1) : NULL;
+}
+
+/**
+ * @brief Retrieves the first node of the specified list.
+ *
+ * @param list The list whose first node wanted to be retrieved.
+ *
+ * @return The first node or NULL if the list is empty.
+ */
+skip_list_node* skip_list_front(const skip_list* list) {
+    assert(list != NULL);
+
+    return list->head[0].next;
+}
+
+/**
+ * @brief Retrieves the node at the specified index in O(log n).
+ *
+ * @param list The list from which the node at the specified index will be retrieved.
+ * @param index The index of the node to retrieve.
+ *
+ * @return The node at the specified index.
+ */
+skip_list_node* skip_list_at(const skip_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    skip_list_level* update[SKIP_LIST_MAX_LEVEL];
+    skip_list_find(list, index + 1, update, NULL);
+    return update[0][0].next;
+}
+
+/**
+ * @brief Retrieves the index of the specified value or -1 if it's not found,
+ *        a sorted list is searched in O(log n).
+ *
+ * @param list The list to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int skip_list_index_of(const skip_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    if (list->compare != NULL) {
+        size_t rank = skip_list_rank(list, val);
+        if (rank < list->size && list->compare(skip_list_at(list, rank)->val, val) == 0) {
+            return (int) rank;
+        }
+        return -1;
+    }
+    int offset = 0;
+    skip_list_for_each(node, list) {
+        if (memcmp(node->val, val, list->element_size) == 0) {
+            return offset;
+        }
+        offset++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Counts the elements of the sorted list which are less than the specified value.
+ *
+ * @param list The sorted list to be searched.
+ * @param val The value to be ranked.
+ *
+ * @return The number of smaller elements, which is the index the value would be inserted at.
+ */
+size_t skip_list_rank(const skip_list* list, const void* val) {
+    assert(list != NULL && list->compare != NULL && val != NULL);
+
+    const skip_list_level* levels = list->head;
+    size_t rank = 0;
+    for (size_t lvl = list->level; lvl-- > 0;) {
+        while (levels[lvl].next != NULL && list->compare(levels[lvl].next->val, val) < 0) {
+            rank += levels[lvl].span;
+            levels = levels[lvl].next->levels;
+        }
+    }
+    return rank;
+}
+
+/**
+ * @brief Insert a new node with the specified value into the end of the positional list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value of the node to be added to the list.
+ */
+void skip_list_push_back(skip_list* list, const void* val) {
+    assert(list != NULL);
+
+    skip_list_insert_at(list, val, list->size);
+}
+
+/**
+ * @brief Insert a new node with the specified value into the front of the positional list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value of the node to be added to the list.
+ */
+void skip_list_push_front(skip_list* list, const void* val) {
+    assert(list != NULL);
+
+    skip_list_insert_at(list, val, 0);
+}
+
+/**
+ * @brief Insert a new node with the specified value at the specified index in O(log n).
+ *
+ * @param list A pointer to a positional list to add to.
+ * @param val The value of the node to be added to the list.
+ * @param index The index at which the node should be inserted.
+ */
+void skip_list_insert_at(skip_list* list, const void* val, size_t index) {
+    assert(list != NULL && val != NULL && index <= list->size);
+
+    skip_list_level* update[SKIP_LIST_MAX_LEVEL];
+    size_t rank[SKIP_LIST_MAX_LEVEL];
+    size_t position = index + 1;
+    skip_list_find(list, position, update, rank);
+
+    size_t height = skip_list_random_height(list);
+    for (; list->level < height; list->level++) {
+        list->head[list->level].next = NULL;
+        list->head[list->level].span = list->size + 1;
+        update[list->level] = list->head;
+        rank[list->level] = 0;
+    }
+    skip_list_node* node = skip_list_create_node(list, val, height);
+    for (size_t lvl = 0; lvl < height; lvl++) {
+        node->levels[lvl].next = update[lvl][lvl].next;
+        node->levels[lvl].span = rank[lvl] + update[lvl][lvl].span + 1 - position;
+        update[lvl][lvl].next = node;
+        update[lvl][lvl].span = position - rank[lvl];
+    }
+    for (size_t lvl = height; lvl < list->level; lvl++) {
+        update[lvl][lvl].span++;
+    }
+    list->size++;
+}
+
+/**
+ * @brief Insert a new node with the specified value into the sorted list after the equal elements.
+ *
+ * @param list A pointer to a sorted list to add to.
+ * @param val The value of the node to be added to the list.
+ */
+void skip_list_insert(skip_list* list, const void* val) {
+    assert(list != NULL && list->compare != NULL && val != NULL);
+
+    const skip_list_level* levels = list->head;
+    size_t rank = 0;
+    for (size_t lvl = list->level; lvl-- > 0;) {
+        while (levels[lvl].next != NULL && list->compare(levels[lvl].next->val, val) <= 0) {
+            rank += levels[lvl].span;
+            levels = levels[lvl].next->levels;
+        }
+    }
+    skip_list_insert_at(list, val, rank);
+}
+
+/**
+ * @brief Remove the last node from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void skip_list_pop_back(skip_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    skip_list_remove_at(list, list->size - 1);
+}
+
+/**
+ * @brief Remove the first node from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void skip_list_pop_front(skip_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    skip_list_remove_at(list, 0);
+}
+
+/**
+ * @brief Remove the node at the specified index from the list in O(log n).
+ *
+ * @param list A pointer to the list to remove from.
+ * @param index The index of the node wanted to be removed from the list.
+ */
+void skip_list_remove_at(skip_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    skip_list_level* update[SKIP_LIST_MAX_LEVEL];
+    skip_list_find(list, index + 1, update, NULL);
+    skip_list_node* node = update[0][0].next;
+    for (size_t lvl = 0; lvl < list->level; lvl++) {
+        if (update[lvl][lvl].next == node) {
+            update[lvl][lvl].span += node->levels[lvl].span - 1;
+            update[lvl][lvl].next = node->levels[lvl].next;
+        }
+        else {
+            update[lvl][lvl].span--;
+        }
+    }
+    while (list->level > 1 && list->head[list->level - 1].next == NULL) {
+        list->level--;
+    }
+    free(node);
+    list->size--;
+}
+
+/**
+ * @brief Remove the first node equal to the specified value from the sorted list.
+ *
+ * @param list A pointer to a sorted list to remove from.
+ * @param val A pointer to the value to be removed from the list.
+ *
+ * @return Whether or not a node was removed.
+ */
+bool skip_list_remove(skip_list* list, const void* val) {
+    assert(list != NULL && list->compare != NULL && val != NULL);
+
+    int index = skip_list_index_of(list, val);
+    if (index < 0) {
+        return false;
+    }
+    skip_list_remove_at(list, (size_t) index);
+    return true;
+}
+
+/**
+ * @brief Remove all the nodes from the specified list.
+ *
+ * @param list A pointer to a list to remove from.
+ */
+void skip_list_clear(skip_list* list) {
+    assert(list != NULL);
+
+    skip_list_node* node = list->head[0].next;
+    while (node != NULL) {
+        skip_list_node* next = node->levels[0].next;
+        free(node);
+        node = next;
+    }
+    list->head[0].next = NULL;
+    list->head[0].span = 1;
+    list->level = 1;
+    list->size = 0;
+}
+
+/**
+ * @brief Gets the size of the specified list.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The size of the specified list.
+ */
+size_t skip_list_size(const skip_list* list) {
+    assert(list != NULL);
+
+    return list->size;
+}
+
+/**
+ * @brief Checks whether or not the specified list is empty.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool skip_list_is_empty(const skip_list* list) {
+    assert(list != NULL);
+
+    return list->size == 0;
+}
+
+/**
+ * @brief Copies the specified list to the specified array.
+ *
+ * @param list The list will be copied to the specified array.
+ * @param array A pointer to the array where the values will be copied.
+ */
+void skip_list_copy_to_array(const skip_list* list, void* array) {
+    assert(list != NULL && (array != NULL || list->size == 0));
+
+    byte* dest = (byte *) array;
+    skip_list_for_each(node, list) {
+        memcpy(dest, node->val, list->element_size);
+        dest += list->element_size;
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file     skip_list.h
+ *
+ * @brief    The Implementation of the Indexable Skip List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#define SKIP_LIST_MAX_LEVEL 32
+
+/* Struct type declaration */
+struct skip_list_level;
+struct skip_list_node;
+struct skip_list;
+
+/* Typedefs */
+typedef struct skip_list_level skip_list_level;
+typedef struct skip_list_node skip_list_node;
+typedef struct skip_list skip_list;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent one forward link of a node, the span is the
+ * number of elements the link skips over plus one.
+ */
+struct skip_list_level {
+    skip_list_node* next;
+    size_t span;
+};
+
+/**
+ * Define the struct represent the node that make skip list, its levels are
+ * allocated together with it right after the value.
+ */
+struct skip_list_node {
+    skip_list_level* levels;
+    size_t height;
+    _Alignas(max_align_t) byte val[];
+};
+
+/**
+ * Define the struct represent the indexable skip list.
+ *
+ * Every link counts the elements it skips, so a search by position adds up
+ * the spans on the way down and positional access, insertion and removal
+ * are O(log n) expected. With a compare function the list keeps its elements
+ * sorted, without one the elements stay where they are inserted.
+ */
+struct skip_list {
+    skip_list_level head[SKIP_LIST_MAX_LEVEL];
+    size_t level;
+    size_t size;
+    size_t element_size;
+    uint64_t random_state;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void skip_list_init(skip_list* list, size_t element_size, int (* compare)(const void* lhs, const void* rhs));
+
+/* Accessing */
+skip_list_node* skip_list_back(const skip_list* list);
+skip_list_node* skip_list_front(const skip_list* list);
+skip_list_node* skip_list_at(const skip_list* list, size_t index);
+int skip_list_index_of(const skip_list* list, const void* val);
+size_t skip_list_rank(const skip_list* list, const void* val);
+
+/* Insertion */
+void skip_list_push_back(skip_list* list, const void* val);
+void skip_list_push_front(skip_list* list, const void* val);
+void skip_list_insert_at(skip_list* list, const void* val, size_t index);
+void skip_list_insert(skip_list* list, const void* val);
+
+/* Removal */
+void skip_list_pop_back(skip_list* list);
+void skip_list_pop_front(skip_list* list);
+void skip_list_remove_at(skip_list* list, size_t index);
+bool skip_list_remove(skip_list* list, const void* val);
+void skip_list_clear(skip_list* list);
+
+/* Utility */
+size_t skip_list_size(const skip_list* list);
+bool skip_list_is_empty(const skip_list* list);
+void skip_list_copy_to_array(const skip_list* list, void* array);
+
+
+/* M A C R O S */
+
+#define skip_list_for_each(node_ptr, list_ptr)                 \
+    for (skip_list_node* node_ptr = (list_ptr)->head[0].next;  \
+         node_ptr != NULL;                                     \
+         node_ptr = (node_ptr)->levels[0].next)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SKIP_LIST_H */
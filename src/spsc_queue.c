@@ -0,0 +1,190 @@
+#include "spsc_queue.h"
+
+/**
+ * @brief Copies count elements between the array and the buffer starting at the specified index,
+ *        in two parts when the range wraps around the end of the buffer.
+ *
+ * @param queue The queue owning the buffer.
+ * @param index The free-running index of the first element.
+ * @param array The array to copy from or to.
+ * @param count The number of elements to copy.
+ * @param to_buffer Whether the elements are copied into the buffer or out of it.
+ */
+static void spsc_queue_copy(spsc_queue* queue, size_t index, byte* array, size_t count, bool to_buffer) {
+    size_t slot = index & (queue->capacity - 1);
+    size_t first = queue->capacity - slot < count ? queue->capacity - slot : count;
+    byte* data = queue->data + slot * queue->element_size;
+    if (to_buffer) {
+        memcpy(data, array, first * queue->element_size);
+        memcpy(queue->data, array + first * queue->element_size, (count - first) * queue->element_size);
+    }
+    else {
+        memcpy(array, data, first * queue->element_size);
+        memcpy(array + first * queue->element_size, queue->data, (count - first) * queue->element_size);
+    }
+}
+
+/**
+ * @brief Initialize the SPSC queue, before the producer and the consumer start.
+ *
+ * @param queue The queue to be initialized.
+ * @param element_size The size in bytes of each element in the queue.
+ * @param capacity The maximum number of elements, rounded up to a power of two.
+ */
+void spsc_queue_init(spsc_queue* queue, size_t element_size, size_t capacity) {
+    assert(queue != NULL && element_size > 0 && capacity > 0);
+
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded *= 2;
+    }
+    queue->data = (byte *) malloc(sizeof(byte) * rounded * element_size);
+    queue->capacity = rounded;
+    queue->element_size = element_size;
+    atomic_init(&queue->tail, (size_t) 0);
+    queue->cached_head = 0;
+    atomic_init(&queue->head, (size_t) 0);
+    queue->cached_tail = 0;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the queue, from the producer thread.
+ *
+ * @param queue A pointer to the queue to add to.
+ * @param val The value to be added to the queue.
+ *
+ * @return Whether or not the value was added, false if the queue is full.
+ */
+bool spsc_queue_push(spsc_queue* queue, const void* val) {
+    assert(queue != NULL && val != NULL);
+
+    return spsc_queue_push_n(queue, val, 1) == 1;
+}
+
+/**
+ * @brief Insert copies of the array elements into the end of the queue, as many as fit,
+ *        from the producer thread. They are published to the consumer at once.
+ *
+ * @param queue A pointer to the queue to add to.
+ * @param array A pointer to the elements to be added.
+ * @param count The number of elements in the array.
+ *
+ * @return The number of elements added.
+ */
+size_t spsc_queue_push_n(spsc_queue* queue, const void* array, size_t count) {
+    assert(queue != NULL && (array != NULL || count == 0));
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t free_slots = queue->capacity - (tail - queue->cached_head);
+    if (free_slots < count) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        free_slots = queue->capacity - (tail - queue->cached_head);
+    }
+    if (count > free_slots) {
+        count = free_slots;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    spsc_queue_copy(queue, tail, (byte *) array, count, true);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    return count;
+}
+
+/**
+ * @brief Removes the first element of the queue into dest, from the consumer thread.
+ *
+ * @param queue A pointer to the queue to remove from.
+ * @param dest A pointer to the memory location where the element will be stored.
+ *
+ * @return Whether or not an element was removed, false if the queue is empty.
+ */
+bool spsc_queue_pop(spsc_queue* queue, void* dest) {
+    assert(queue != NULL && dest != NULL);
+
+    return spsc_queue_pop_n(queue, dest, 1) == 1;
+}
+
+/**
+ * @brief Removes up to count elements from the front of the queue into the array,
+ *        from the consumer thread. Their slots are released to the producer at once.
+ *
+ * @param queue A pointer to the queue to remove from.
+ * @param array A pointer to the memory receiving the elements.
+ * @param count The maximum number of elements to remove.
+ *
+ * @return The number of elements removed.
+ */
+size_t spsc_queue_pop_n(spsc_queue* queue, void* array, size_t count) {
+    assert(queue != NULL && (array != NULL || count == 0));
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = queue->cached_tail - head;
+    if (available < count) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cached_tail - head;
+    }
+    if (count > available) {
+        count = available;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    spsc_queue_copy(queue, head, (byte *) array, count, false);
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+    return count;
+}
+
+/**
+ * @brief Frees the memory allocated for the queue buffer, after the producer and the consumer stopped.
+ *
+ * @param queue A pointer to the queue to free from.
+ */
+void spsc_queue_destroy(spsc_queue* queue) {
+    assert(queue != NULL);
+
+    free(queue->data);
+    queue->data = NULL;
+    queue->capacity = 0;
+}
+
+/**
+ * @brief Gets the number of elements in the specified queue, it may be stale when read by a third thread.
+ *
+ * @param queue The queue whose size will be returned.
+ *
+ * @return The number of elements in the queue.
+ */
+size_t spsc_queue_size(const spsc_queue* queue) {
+    assert(queue != NULL);
+
+    size_t head = atomic_load_explicit((_Atomic size_t *) &queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit((_Atomic size_t *) &queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+/**
+ * @brief Gets the maximum number of elements of the specified queue.
+ *
+ * @param queue The queue whose capacity will be returned.
+ *
+ * @return The capacity of the queue.
+ */
+size_t spsc_queue_capacity(const spsc_queue* queue) {
+    assert(queue != NULL);
+
+    return queue->capacity;
+}
+
+/**
+ * @brief Checks whether the queue is empty or not.
+ *
+ * @param queue The queue to be checked.
+ *
+ * @return Whether or not the queue is empty.
+ */
+bool spsc_queue_is_empty(const spsc_queue* queue) {
+    assert(queue != NULL);
+
+    return spsc_queue_size(queue) == 0;
+}
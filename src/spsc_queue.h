@@ -0,0 +1,80 @@
+/**
+ * @file     spsc_queue.h
+ *
+ * @brief    The Implementation of Lock-Free Single-Producer Single-Consumer Queue.
+ * @author   Hassan Tarek
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <assert.h>
+
+#ifndef SPSC_QUEUE_CACHE_LINE
+#define SPSC_QUEUE_CACHE_LINE 64
+#endif /* SPSC_QUEUE_CACHE_LINE */
+
+/* Struct type declaration */
+struct spsc_queue;
+
+/* Typedefs */
+typedef struct spsc_queue spsc_queue;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the bounded queue between one producer thread and one consumer thread.
+ *
+ * Head and tail count the popped and pushed elements and are masked into
+ * the power-of-two buffer. Each index sits on its own cache line with the
+ * copy of the opposite index its owner last read, so a side only reloads the
+ * other index, with acquire ordering, when its cached copy says the queue
+ * is full or empty. Publishing uses a release store, no read-modify-write
+ * is ever needed. A queue allocated on the heap should use aligned_alloc
+ * to keep the lines apart.
+ */
+struct spsc_queue {
+    byte* data;
+    size_t capacity;
+    size_t element_size;
+    _Alignas(SPSC_QUEUE_CACHE_LINE) _Atomic size_t tail;
+    size_t cached_head;
+    _Alignas(SPSC_QUEUE_CACHE_LINE) _Atomic size_t head;
+    size_t cached_tail;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void spsc_queue_init(spsc_queue* queue, size_t element_size, size_t capacity);
+
+/* Insertion */
+bool spsc_queue_push(spsc_queue* queue, const void* val);
+size_t spsc_queue_push_n(spsc_queue* queue, const void* array, size_t count);
+
+/* Removal */
+bool spsc_queue_pop(spsc_queue* queue, void* dest);
+size_t spsc_queue_pop_n(spsc_queue* queue, void* array, size_t count);
+void spsc_queue_destroy(spsc_queue* queue);
+
+/* Utility */
+size_t spsc_queue_size(const spsc_queue* queue);
+size_t spsc_queue_capacity(const spsc_queue* queue);
+bool spsc_queue_is_empty(const spsc_queue* queue);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SPSC_QUEUE_H */
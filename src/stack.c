@@ -36,8 +36,7 @@ node* stack_top(const stack* stack) {
 void stack_push(stack* stack, const void* val) {
     assert(stack != NULL);
 
-    node* node_ptr = (node *) malloc(sizeof(node));
-    node_ptr->val = (byte *) malloc(sizeof(byte) * stack->element_size);
+    node* node_ptr = (node *) malloc(sizeof(node) + sizeof(byte) * stack->element_size);
     memcpy(node_ptr->val, val, sizeof(byte) * stack->element_size);
     node_ptr->prev = stack->top;
     stack->top = node_ptr;
@@ -56,8 +55,6 @@ void stack_pop(stack* stack) {
     stack->top = stack->top->prev;
     temp->prev = NULL;
     stack->size--;
-    free(temp->val);
-    temp->val = NULL;
     free(temp);
     temp = NULL;
 }
@@ -30,10 +30,12 @@ typedef uint8_t byte;
 
 /**
  * Define the struct represent the node that make stack.
+ *
+ * The value is stored inline after the link, so a node is a single allocation.
  */
 struct node {
-    void* val;
     node* prev;
+    _Alignas(max_align_t) byte val[];
 };
 
 /**
@@ -0,0 +1,198 @@
+#include "topk.h"
+
+/**
+ * @brief Retrieves a pointer to the heap element at the specified index.
+ *
+ * @param topk The accumulator.
+ * @param index The index in the heap.
+ *
+ * @return A pointer to the element.
+ */
+static byte* topk_slot(const topk* topk, size_t index) {
+    return topk->heap.data + index * topk->heap.element_size;
+}
+
+/**
+ * @brief Swaps two heap elements.
+ *
+ * @param topk The accumulator.
+ * @param lhs The index of the first element.
+ * @param rhs The index of the second element.
+ */
+static void topk_swap(topk* topk, size_t lhs, size_t rhs) {
+    size_t element_size = topk->heap.element_size;
+    memcpy(topk->temp, topk_slot(topk, lhs), element_size);
+    memcpy(topk_slot(topk, lhs), topk_slot(topk, rhs), element_size);
+    memcpy(topk_slot(topk, rhs), topk->temp, element_size);
+}
+
+/**
+ * @brief Moves the element at the specified index up until its parent is not smaller.
+ *
+ * @param topk The accumulator.
+ * @param index The index to sift up from.
+ */
+static void topk_sift_up(topk* topk, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (topk->compare(topk_slot(topk, parent), topk_slot(topk, index)) >= 0) {
+            return;
+        }
+        topk_swap(topk, parent, index);
+        index = parent;
+    }
+}
+
+/**
+ * @brief Moves the element at the specified index down until no child is greater.
+ *
+ * @param topk The accumulator.
+ * @param index The index to sift down from.
+ */
+static void topk_sift_down(topk* topk, size_t index) {
+    size_t size = topk->heap.size;
+    while (true) {
+        size_t largest = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        if (left < size && topk->compare(topk_slot(topk, left), topk_slot(topk, largest)) > 0) {
+            largest = left;
+        }
+        if (right < size && topk->compare(topk_slot(topk, right), topk_slot(topk, largest)) > 0) {
+            largest = right;
+        }
+        if (largest == index) {
+            return;
+        }
+        topk_swap(topk, index, largest);
+        index = largest;
+    }
+}
+
+/**
+ * @brief Initialize the top-k accumulator.
+ *
+ * @param topk The accumulator to be initialized.
+ * @param k The number of elements to be kept.
+ * @param element_size The size in bytes of each element.
+ * @param compare The compare function ordering the elements, as for vector_sort.
+ */
+void topk_init(topk* topk, size_t k, size_t element_size, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(topk != NULL && k > 0 && element_size > 0 && compare != NULL);
+
+    vector_init(&topk->heap, element_size);
+    vector_reserve(&topk->heap, 2 * k + 1);
+    topk->k = k;
+    topk->temp = (byte *) malloc(sizeof(byte) * element_size);
+    topk->compare = compare;
+}
+
+/**
+ * @brief Copies the last of the kept elements, the one the next push has to beat.
+ *
+ * @param topk The accumulator.
+ * @param dest A pointer to the memory location where the element will be stored.
+ */
+void topk_worst(const topk* topk, void* dest) {
+    assert(topk != NULL && topk->heap.size > 0 && dest != NULL);
+
+    vector_front(&topk->heap, dest);
+}
+
+/**
+ * @brief Offers the specified element to the accumulator in O(log k).
+ *
+ * @param topk A pointer to the accumulator.
+ * @param val The element to be offered.
+ */
+void topk_push(topk* topk, const void* val) {
+    assert(topk != NULL && val != NULL);
+
+    if (topk->heap.size < topk->k) {
+        vector_push_back(&topk->heap, (void *) val);
+        topk_sift_up(topk, topk->heap.size - 1);
+    }
+    else if (topk->compare(val, topk_slot(topk, 0)) < 0) {
+        memcpy(topk_slot(topk, 0), val, topk->heap.element_size);
+        topk_sift_down(topk, 0);
+    }
+}
+
+/**
+ * @brief Offers all the elements of the specified array to the accumulator.
+ *
+ * @param topk A pointer to the accumulator.
+ * @param array The elements to be offered.
+ * @param array_size The number of elements in the specified array.
+ */
+void topk_push_array(topk* topk, const void* array, size_t array_size) {
+    assert(topk != NULL && array != NULL);
+
+    const byte* src = (const byte *) array;
+    for (size_t i = 0; i < array_size; i++) {
+        topk_push(topk, src + i * topk->heap.element_size);
+    }
+}
+
+/**
+ * @brief Remove all the kept elements.
+ *
+ * @param topk A pointer to the accumulator.
+ */
+void topk_clear(topk* topk) {
+    assert(topk != NULL);
+
+    topk->heap.size = 0;
+}
+
+/**
+ * @brief Frees the memory allocated for the accumulator.
+ *
+ * @param topk A pointer to the accumulator.
+ */
+void topk_destroy(topk* topk) {
+    assert(topk != NULL);
+
+    vector_destroy(&topk->heap);
+    free(topk->temp);
+    topk->temp = NULL;
+}
+
+/**
+ * @brief Gets the number of kept elements.
+ *
+ * @param topk The accumulator.
+ *
+ * @return The number of kept elements, at most k.
+ */
+size_t topk_size(const topk* topk) {
+    assert(topk != NULL);
+
+    return topk->heap.size;
+}
+
+/**
+ * @brief Checks whether or not the accumulator already holds k elements.
+ *
+ * @param topk The accumulator.
+ *
+ * @return Whether or not the accumulator is full.
+ */
+bool topk_is_full(const topk* topk) {
+    assert(topk != NULL);
+
+    return topk->heap.size == topk->k;
+}
+
+/**
+ * @brief Copies the kept elements to the specified array, sorted by the compare function.
+ *
+ * @param topk The accumulator.
+ * @param array The array where the elements will be copied.
+ */
+void topk_copy_to_array(const topk* topk, void* array) {
+    assert(topk != NULL && array != NULL);
+
+    vector_copy_to_array(&topk->heap, array);
+    qsort(array, topk->heap.size, topk->heap.element_size, topk->compare);
+}
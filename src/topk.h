@@ -0,0 +1,72 @@
+/**
+ * @file     topk.h
+ *
+ * @brief    The Implementation of the Streaming Top-K Accumulator.
+ * @author   Hassan Tarek
+ */
+
+#ifndef TOPK_H
+#define TOPK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+
+/* Struct type declaration */
+struct topk;
+
+/* Typedefs */
+typedef struct topk topk;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the top-k accumulator.
+ *
+ * It keeps the k elements that come first under the compare function in a
+ * bounded max-heap, so each pushed element costs O(log k). Pass a reversed
+ * comparator to keep the k largest elements.
+ */
+struct topk {
+    vector heap;
+    size_t k;
+    byte* temp;
+    int (* compare)(const void* lhs, const void* rhs);
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void topk_init(topk* topk, size_t k, size_t element_size, int (* compare)(const void* lhs, const void* rhs));
+
+/* Accessing */
+void topk_worst(const topk* topk, void* dest);
+
+/* Insertion */
+void topk_push(topk* topk, const void* val);
+void topk_push_array(topk* topk, const void* array, size_t array_size);
+
+/* Removal */
+void topk_clear(topk* topk);
+void topk_destroy(topk* topk);
+
+/* Utility */
+size_t topk_size(const topk* topk);
+bool topk_is_full(const topk* topk);
+void topk_copy_to_array(const topk* topk, void* array);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* TOPK_H */
@@ -0,0 +1,359 @@
+#include "unrolled_list.h"
+
+/**
+ * @brief Create a new empty node.
+ *
+ * @param list The list the node belongs to.
+ *
+ * @return A pointer to the newly created node.
+ */
+static unrolled_node* unrolled_list_create_node(const unrolled_list* list) {
+    unrolled_node* node = (unrolled_node *) malloc(sizeof(unrolled_node) +
+                                                   sizeof(byte) * list->node_capacity * list->element_size);
+    node->next = NULL;
+    node->prev = NULL;
+    node->count = 0;
+    return node;
+}
+
+/**
+ * @brief Links the new node after the specified node, or at the front when it is NULL.
+ *
+ * @param list The list to link into.
+ * @param prev The node which will precede the new node.
+ * @param node The node to be linked.
+ */
+static void unrolled_list_link_after(unrolled_list* list, unrolled_node* prev, unrolled_node* node) {
+    node->prev = prev;
+    node->next = prev != NULL ? prev->next : list->head;
+    if (node->next != NULL)
+        node->next->prev = node;
+    else
+        list->tail = node;
+    if (prev != NULL)
+        prev->next = node;
+    else
+        list->head = node;
+}
+
+/**
+ * @brief Unlinks the specified node from the list and frees it.
+ *
+ * @param list The list to unlink from.
+ * @param node The node to be freed.
+ */
+static void unrolled_list_free_node(unrolled_list* list, unrolled_node* node) {
+    if (node->prev != NULL)
+        node->prev->next = node->next;
+    else
+        list->head = node->next;
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    else
+        list->tail = node->prev;
+    free(node);
+}
+
+/**
+ * @brief Gets the element at the specified position of a node.
+ */
+static byte* unrolled_list_element(const unrolled_list* list, const unrolled_node* node, size_t offset) {
+    return (byte *) node->data + offset * list->element_size;
+}
+
+/**
+ * @brief Finds the node holding the element at the specified index by skipping
+ *        whole nodes from the nearest end of the list.
+ *
+ * @param list The list to be searched.
+ * @param index The index of the element, less than the size.
+ * @param offset Receives the position of the element in the node.
+ *
+ * @return The node holding the element.
+ */
+static unrolled_node* unrolled_list_locate(const unrolled_list* list, size_t index, size_t* offset) {
+    unrolled_node* node;
+    if (index < list->size / 2) {
+        node = list->head;
+        while (index >= node->count) {
+            index -= node->count;
+            node = node->next;
+        }
+    }
+    else {
+        size_t remaining = list->size - index;
+        node = list->tail;
+        while (remaining > node->count) {
+            remaining -= node->count;
+            node = node->prev;
+        }
+        index = node->count - remaining;
+    }
+    *offset = index;
+    return node;
+}
+
+/**
+ * @brief Initialize the unrolled list.
+ *
+ * @param list The list to be initialized.
+ * @param element_size The size in bytes of each element in the list.
+ */
+void unrolled_list_init(unrolled_list* list, size_t element_size) {
+    assert(list != NULL && element_size > 0);
+
+    size_t capacity = (UNROLLED_LIST_NODE_SIZE - sizeof(unrolled_node)) / element_size;
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->element_size = element_size;
+    list->node_capacity = capacity > UNROLLED_LIST_MIN_NODE_CAPACITY ? capacity : UNROLLED_LIST_MIN_NODE_CAPACITY;
+}
+
+/**
+ * @brief Retrieves the last element of the specified list.
+ *
+ * @param list The list whose last element wanted to be retrieved.
+ *
+ * @return A pointer to the last element or NULL if the list is empty.
+ */
+void* unrolled_list_back(const unrolled_list* list) {
+    assert(list != NULL);
+
+    return list->tail != NULL ? unrolled_list_element(list, list->tail, list->tail->count - 1) : NULL;
+}
+
+/**
+ * @brief Retrieves the first element of the specified list.
+ *
+ * @param list The list whose first element wanted to be retrieved.
+ *
+ * @return A pointer to the first element or NULL if the list is empty.
+ */
+void* unrolled_list_front(const unrolled_list* list) {
+    assert(list != NULL);
+
+    return list->head != NULL ? list->head->data : NULL;
+}
+
+/**
+ * @brief Retrieves the element at the specified index from the specified list.
+ *
+ * @param list The list from which the element at the specified index will be retrieved.
+ * @param index The index of the element to retrieve.
+ *
+ * @return A pointer to the element at the specified index.
+ */
+void* unrolled_list_at(const unrolled_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    size_t offset;
+    unrolled_node* node = unrolled_list_locate(list, index, &offset);
+    return unrolled_list_element(list, node, offset);
+}
+
+/**
+ * @brief Retrieves the index of the specified value or -1 if it's not found.
+ *
+ * @param list The list to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int unrolled_list_index_of(const unrolled_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    int offset = 0;
+    unrolled_list_for_each(element, list) {
+        if (memcmp(element, val, list->element_size) == 0) {
+            return offset;
+        }
+        offset++;
+    }
+    return -1;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void unrolled_list_push_back(unrolled_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    if (list->tail == NULL || list->tail->count == list->node_capacity) {
+        unrolled_list_link_after(list, list->tail, unrolled_list_create_node(list));
+    }
+    memcpy(unrolled_list_element(list, list->tail, list->tail->count), val, list->element_size);
+    list->tail->count++;
+    list->size++;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the front of the list.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ */
+void unrolled_list_push_front(unrolled_list* list, const void* val) {
+    assert(list != NULL && val != NULL);
+
+    if (list->head == NULL || list->head->count == list->node_capacity) {
+        unrolled_list_link_after(list, NULL, unrolled_list_create_node(list));
+    }
+    unrolled_node* head = list->head;
+    memmove(unrolled_list_element(list, head, 1), head->data, sizeof(byte) * head->count * list->element_size);
+    memcpy(head->data, val, list->element_size);
+    head->count++;
+    list->size++;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the specified index of the list,
+ *        a full node is split in halves first.
+ *
+ * @param list A pointer to a list to add to.
+ * @param val The value to be added to the list.
+ * @param index The index at which the value should be inserted.
+ */
+void unrolled_list_insert_at(unrolled_list* list, const void* val, size_t index) {
+    assert(list != NULL && val != NULL && index <= list->size);
+
+    if (index == list->size) {
+        unrolled_list_push_back(list, val);
+        return;
+    }
+    size_t offset;
+    unrolled_node* node = unrolled_list_locate(list, index, &offset);
+    if (node->count == list->node_capacity) {
+        unrolled_node* right = unrolled_list_create_node(list);
+        right->count = node->count / 2;
+        node->count -= right->count;
+        memcpy(right->data, unrolled_list_element(list, node, node->count),
+               sizeof(byte) * right->count * list->element_size);
+        unrolled_list_link_after(list, node, right);
+        if (offset > node->count) {
+            offset -= node->count;
+            node = right;
+        }
+    }
+    memmove(unrolled_list_element(list, node, offset + 1), unrolled_list_element(list, node, offset),
+            sizeof(byte) * (node->count - offset) * list->element_size);
+    memcpy(unrolled_list_element(list, node, offset), val, list->element_size);
+    node->count++;
+    list->size++;
+}
+
+/**
+ * @brief Remove the last element from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void unrolled_list_pop_back(unrolled_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    unrolled_list_remove_at(list, list->size - 1);
+}
+
+/**
+ * @brief Remove the first element from the list.
+ *
+ * @param list A pointer to the list to remove from.
+ */
+void unrolled_list_pop_front(unrolled_list* list) {
+    assert(list != NULL && list->size > 0);
+
+    unrolled_list_remove_at(list, 0);
+}
+
+/**
+ * @brief Remove the element at the specified index from the list, a node left
+ *        less than half full is merged with its next node when they fit in one.
+ *
+ * @param list A pointer to the list to remove from.
+ * @param index The index of the element wanted to be removed from the list.
+ */
+void unrolled_list_remove_at(unrolled_list* list, size_t index) {
+    assert(list != NULL && index < list->size);
+
+    size_t offset;
+    unrolled_node* node = unrolled_list_locate(list, index, &offset);
+    node->count--;
+    memmove(unrolled_list_element(list, node, offset), unrolled_list_element(list, node, offset + 1),
+            sizeof(byte) * (node->count - offset) * list->element_size);
+    list->size--;
+
+    unrolled_node* next = node->next;
+    if (node->count == 0) {
+        unrolled_list_free_node(list, node);
+    }
+    else if (node->count < list->node_capacity / 2 && next != NULL &&
+             node->count + next->count <= list->node_capacity) {
+        memcpy(unrolled_list_element(list, node, node->count), next->data,
+               sizeof(byte) * next->count * list->element_size);
+        node->count += next->count;
+        unrolled_list_free_node(list, next);
+    }
+}
+
+/**
+ * @brief Remove all the elements from the specified list.
+ *
+ * @param list A pointer to a list to remove from.
+ */
+void unrolled_list_clear(unrolled_list* list) {
+    assert(list != NULL);
+
+    unrolled_node* node = list->head;
+    while (node != NULL) {
+        unrolled_node* next = node->next;
+        free(node);
+        node = next;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/**
+ * @brief Gets the size of the specified list.
+ *
+ * @param list The list whose size will be returned.
+ *
+ * @return The size of the specified list.
+ */
+size_t unrolled_list_size(const unrolled_list* list) {
+    assert(list != NULL);
+
+    return list->size;
+}
+
+/**
+ * @brief Checks whether or not the specified list is empty.
+ *
+ * @param list The list to be checked.
+ *
+ * @return Whether or not the list is empty.
+ */
+bool unrolled_list_is_empty(const unrolled_list* list) {
+    assert(list != NULL);
+
+    return list->size == 0;
+}
+
+/**
+ * @brief Copies the specified list to the specified array, one copy per node.
+ *
+ * @param list The list will be copied to the specified array.
+ * @param array A pointer to the array where the values will be copied.
+ */
+void unrolled_list_copy_to_array(const unrolled_list* list, void* array) {
+    assert(list != NULL && (array != NULL || list->size == 0));
+
+    byte* dest = (byte *) array;
+    for (unrolled_node* node = list->head; node != NULL; node = node->next) {
+        memcpy(dest, node->data, sizeof(byte) * node->count * list->element_size);
+        dest += node->count * list->element_size;
+    }
+}
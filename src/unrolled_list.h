@@ -0,0 +1,112 @@
+/**
+ * @file     unrolled_list.h
+ *
+ * @brief    The Implementation of the Unrolled Linked List.
+ * @author   Hassan Tarek
+ */
+
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct unrolled_node;
+struct unrolled_list;
+
+/* Typedefs */
+typedef struct unrolled_node unrolled_node;
+typedef struct unrolled_list unrolled_list;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the node that make unrolled list, it holds
+ * up to node_capacity elements packed in its data.
+ */
+struct unrolled_node {
+    unrolled_node* next;
+    unrolled_node* prev;
+    size_t count;
+    _Alignas(max_align_t) byte data[];
+};
+
+/**
+ * Define the struct represent the unrolled linked list.
+ *
+ * Each node is sized to UNROLLED_LIST_NODE_SIZE bytes, so a traversal reads
+ * whole cache lines of elements and a positional access skips whole nodes.
+ * A full node is split in halves on insertion and a node less than half
+ * full is merged with its next node on removal when they fit in one.
+ */
+struct unrolled_list {
+    unrolled_node* head;
+    unrolled_node* tail;
+    size_t size;
+    size_t element_size;
+    size_t node_capacity;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void unrolled_list_init(unrolled_list* list, size_t element_size);
+
+/* Accessing */
+void* unrolled_list_back(const unrolled_list* list);
+void* unrolled_list_front(const unrolled_list* list);
+void* unrolled_list_at(const unrolled_list* list, size_t index);
+int unrolled_list_index_of(const unrolled_list* list, const void* val);
+
+/* Insertion */
+void unrolled_list_push_back(unrolled_list* list, const void* val);
+void unrolled_list_push_front(unrolled_list* list, const void* val);
+void unrolled_list_insert_at(unrolled_list* list, const void* val, size_t index);
+
+/* Removal */
+void unrolled_list_pop_back(unrolled_list* list);
+void unrolled_list_pop_front(unrolled_list* list);
+void unrolled_list_remove_at(unrolled_list* list, size_t index);
+void unrolled_list_clear(unrolled_list* list);
+
+/* Utility */
+size_t unrolled_list_size(const unrolled_list* list);
+bool unrolled_list_is_empty(const unrolled_list* list);
+void unrolled_list_copy_to_array(const unrolled_list* list, void* array);
+
+
+/* M A C R O S */
+
+#define UNROLLED_LIST_NODE_SIZE 256
+#define UNROLLED_LIST_MIN_NODE_CAPACITY 4
+
+/*
+ * The outer loop only declares the current node and runs once, the inner one
+ * steps through the elements and moves to the next node at the end of each,
+ * so a break in the body ends the whole traversal.
+ */
+#define unrolled_list_for_each(val_ptr, list_ptr)                                            \
+    for (unrolled_node* val_ptr##_node = (list_ptr)->head;                                   \
+         val_ptr##_node != NULL;                                                             \
+         val_ptr##_node = NULL)                                                              \
+        for (byte* val_ptr = val_ptr##_node->data;                                           \
+             val_ptr != NULL;                                                                \
+             val_ptr = val_ptr + (list_ptr)->element_size !=                                 \
+                       val_ptr##_node->data + val_ptr##_node->count * (list_ptr)->element_size \
+                       ? val_ptr + (list_ptr)->element_size                                  \
+                       : (val_ptr##_node = val_ptr##_node->next) != NULL ? val_ptr##_node->data : NULL)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* UNROLLED_LIST_H */
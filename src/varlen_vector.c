@@ -0,0 +1,305 @@
+#include "varlen_vector.h"
+
+/**
+ * @brief Makes room for count more elements holding data_size more payload bytes.
+ *
+ * @param vector The vector to grow.
+ * @param count The number of elements to be added.
+ * @param data_size The number of payload bytes to be added.
+ */
+static void varlen_vector_grow(varlen_vector* vector, size_t count, size_t data_size) {
+    size_t used = vector->offsets[vector->size];
+    size_t new_capacity = vector->capacity;
+    size_t new_data_capacity = vector->data_capacity;
+    if (vector->size + count > vector->capacity) {
+        new_capacity = (vector->size + count) * 2 + 1;
+    }
+    if (used + data_size > vector->data_capacity) {
+        new_data_capacity = (used + data_size) * 2 + 1;
+    }
+    if (new_capacity != vector->capacity || new_data_capacity != vector->data_capacity) {
+        varlen_vector_reserve(vector, new_capacity, new_data_capacity);
+    }
+}
+
+/**
+ * @brief Sorts the element indices by the elements they refer to with a stable merge sort.
+ *
+ * @param vector The vector holding the elements.
+ * @param indices The indices to be sorted.
+ * @param temp A scratch array of the same size.
+ * @param compare The compare function used to order the elements.
+ */
+static void varlen_vector_sort_indices(const varlen_vector* vector, size_t* indices, size_t* temp,
+                                       int (* compare)(const void*, size_t, const void*, size_t)) {
+    size_t size = vector->size;
+    for (size_t width = 1; width < size; width *= 2) {
+        for (size_t left = 0; left < size; left += 2 * width) {
+            size_t mid = left + width < size ? left + width : size;
+            size_t right = left + 2 * width < size ? left + 2 * width : size;
+            size_t i = left;
+            size_t j = mid;
+            size_t k = left;
+            while (i < mid && j < right) {
+                size_t lhs = indices[i];
+                size_t rhs = indices[j];
+                int cmp = compare(vector->data + vector->offsets[lhs],
+                                  vector->offsets[lhs + 1] - vector->offsets[lhs],
+                                  vector->data + vector->offsets[rhs],
+                                  vector->offsets[rhs + 1] - vector->offsets[rhs]);
+                temp[k++] = cmp > 0 ? indices[j++] : indices[i++];
+            }
+            while (i < mid) {
+                temp[k++] = indices[i++];
+            }
+            while (j < right) {
+                temp[k++] = indices[j++];
+            }
+        }
+        memcpy(indices, temp, sizeof(size_t) * size);
+    }
+}
+
+/**
+ * @brief Initialize the variable-length element vector.
+ *
+ * @param vector The vector to be initialized.
+ */
+void varlen_vector_init(varlen_vector* vector) {
+    assert(vector != NULL);
+
+    vector->data = (byte *) malloc(sizeof(byte) * VARLEN_VECTOR_INIT_DATA_CAPACITY);
+    vector->offsets = (varlen_offset *) malloc(sizeof(varlen_offset) * (VARLEN_VECTOR_INIT_CAPACITY + 1));
+    vector->offsets[0] = 0;
+    vector->size = 0;
+    vector->capacity = VARLEN_VECTOR_INIT_CAPACITY;
+    vector->data_capacity = VARLEN_VECTOR_INIT_DATA_CAPACITY;
+}
+
+/**
+ * @brief Retrieves a view of the element at the specified index, no copy is made.
+ *        The view is valid until the vector is modified.
+ *
+ * @param vector The vector from which the element will be retrieved.
+ * @param index The index of the wanted element.
+ * @param length A pointer receiving the length in bytes of the element, may be NULL.
+ *
+ * @return A pointer to the first byte of the element.
+ */
+const void* varlen_vector_at(const varlen_vector* vector, size_t index, size_t* length) {
+    assert(vector != NULL && vector->data != NULL && index < vector->size);
+
+    if (length != NULL) {
+        *length = vector->offsets[index + 1] - vector->offsets[index];
+    }
+    return vector->data + vector->offsets[index];
+}
+
+/**
+ * @brief Gets the length in bytes of the element at the specified index.
+ *
+ * @param vector The vector holding the element.
+ * @param index The index of the element.
+ *
+ * @return The length in bytes of the element.
+ */
+size_t varlen_vector_length(const varlen_vector* vector, size_t index) {
+    assert(vector != NULL && index < vector->size);
+
+    return vector->offsets[index + 1] - vector->offsets[index];
+}
+
+/**
+ * @brief Retrieves the index of the specified value or -1 if it's not found.
+ *
+ * @param vector The vector to be searched.
+ * @param val The value to be searched for.
+ * @param length The length in bytes of the value.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int varlen_vector_index_of(const varlen_vector* vector, const void* val, size_t length) {
+    assert(vector != NULL && vector->data != NULL && (val != NULL || length == 0));
+
+    varlen_vector_for_each(index, vector) {
+        size_t begin = vector->offsets[index];
+        if (vector->offsets[index + 1] - begin == length &&
+            (length == 0 || memcmp(vector->data + begin, val, length) == 0)) {
+            return (int) index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Insert a copy of the specified value into the end of the vector.
+ *
+ * @param vector A pointer to a vector to add to.
+ * @param val The value to be added to the vector.
+ * @param length The length in bytes of the value.
+ */
+void varlen_vector_push_back(varlen_vector* vector, const void* val, size_t length) {
+    assert(vector != NULL && vector->data != NULL && (val != NULL || length == 0));
+
+    varlen_vector_grow(vector, 1, length);
+    size_t end = vector->offsets[vector->size];
+    assert(end + length <= (varlen_offset) -1);
+    if (length > 0) {
+        memcpy(vector->data + end, val, length);
+    }
+    vector->offsets[vector->size + 1] = (varlen_offset) (end + length);
+    vector->size++;
+}
+
+/**
+ * @brief Append all the elements of other to the end of the vector
+ *        with a single copy of the payload bytes.
+ *
+ * @param vector A pointer to a vector to add to.
+ * @param other The vector whose elements will be appended, it must be a different vector.
+ */
+void varlen_vector_append(varlen_vector* vector, const varlen_vector* other) {
+    assert(vector != NULL && other != NULL && vector != other);
+
+    size_t other_size = other->offsets[other->size];
+    varlen_vector_grow(vector, other->size, other_size);
+    size_t end = vector->offsets[vector->size];
+    assert(end + other_size <= (varlen_offset) -1);
+    memcpy(vector->data + end, other->data, other_size);
+    for (size_t i = 1; i <= other->size; i++) {
+        vector->offsets[vector->size + i] = (varlen_offset) (end + other->offsets[i]);
+    }
+    vector->size += other->size;
+}
+
+/**
+ * @brief Remove the last element from the vector.
+ *
+ * @param vector A pointer to the vector to remove from.
+ */
+void varlen_vector_pop_back(varlen_vector* vector) {
+    assert(vector != NULL && vector->size > 0);
+
+    vector->size--;
+}
+
+/**
+ * @brief Remove all the vector elements.
+ *
+ * @param vector A pointer to the vector to remove from.
+ */
+void varlen_vector_clear(varlen_vector* vector) {
+    assert(vector != NULL);
+
+    vector->size = 0;
+}
+
+/**
+ * @brief Frees the memory allocated for the vector data and offsets.
+ *
+ * @param vector A pointer to the vector to free from.
+ */
+void varlen_vector_destroy(varlen_vector* vector) {
+    assert(vector != NULL);
+
+    free(vector->data);
+    vector->data = NULL;
+    free(vector->offsets);
+    vector->offsets = NULL;
+    vector->size = 0;
+    vector->capacity = 0;
+    vector->data_capacity = 0;
+}
+
+/**
+ * @brief Gets the number of elements in the specified vector.
+ *
+ * @param vector The vector whose size will be returned.
+ *
+ * @return The number of elements in the vector.
+ */
+size_t varlen_vector_size(const varlen_vector* vector) {
+    assert(vector != NULL);
+
+    return vector->size;
+}
+
+/**
+ * @brief Gets the total length in bytes of the elements of the specified vector.
+ *
+ * @param vector The vector whose payload size will be returned.
+ *
+ * @return The number of payload bytes in the vector.
+ */
+size_t varlen_vector_data_size(const varlen_vector* vector) {
+    assert(vector != NULL);
+
+    return vector->offsets[vector->size];
+}
+
+/**
+ * @brief Checks whether the vector is empty or not.
+ *
+ * @param vector The vector to be checked.
+ *
+ * @return Whether or not the vector is empty.
+ */
+bool varlen_vector_is_empty(const varlen_vector* vector) {
+    assert(vector != NULL);
+
+    return vector->size == 0;
+}
+
+/**
+ * @brief Reserves the required space for the specified vector.
+ *
+ * @param vector The vector for which we will reserve a space.
+ * @param new_capacity The number of elements to reserve.
+ * @param new_data_capacity The number of payload bytes to reserve.
+ */
+void varlen_vector_reserve(varlen_vector* vector, size_t new_capacity, size_t new_data_capacity) {
+    assert(vector != NULL && new_capacity >= vector->size &&
+           new_data_capacity >= vector->offsets[vector->size]);
+
+    vector->offsets = realloc(vector->offsets, sizeof(varlen_offset) * (new_capacity + 1));
+    vector->data = realloc(vector->data, sizeof(byte) * new_data_capacity);
+    vector->capacity = new_capacity;
+    vector->data_capacity = new_data_capacity;
+}
+
+/**
+ * @brief Sorts the specified vector with a stable merge sort, the payloads are
+ *        repacked once in the sorted order.
+ *
+ * @param vector The vector whose elements will be sorted.
+ * @param compare The compare function used to sort the vector, it receives the elements with their lengths.
+ */
+void varlen_vector_sort(varlen_vector* vector,
+                        int (* compare)(const void* lhs, size_t lhs_length, const void* rhs, size_t rhs_length)) {
+    assert(vector != NULL && compare != NULL);
+
+    if (vector->size < 2) {
+        return;
+    }
+    size_t* indices = (size_t *) malloc(sizeof(size_t) * vector->size * 2);
+    for (size_t i = 0; i < vector->size; i++) {
+        indices[i] = i;
+    }
+    varlen_vector_sort_indices(vector, indices, indices + vector->size, compare);
+
+    byte* data = (byte *) malloc(sizeof(byte) * vector->data_capacity);
+    varlen_offset* offsets = (varlen_offset *) malloc(sizeof(varlen_offset) * (vector->capacity + 1));
+    offsets[0] = 0;
+    for (size_t i = 0; i < vector->size; i++) {
+        size_t begin = vector->offsets[indices[i]];
+        size_t length = vector->offsets[indices[i] + 1] - begin;
+        memcpy(data + offsets[i], vector->data + begin, length);
+        offsets[i + 1] = (varlen_offset) (offsets[i] + length);
+    }
+    free(vector->data);
+    free(vector->offsets);
+    vector->data = data;
+    vector->offsets = offsets;
+    free(indices);
+    indices = NULL;
+}
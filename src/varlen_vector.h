@@ -0,0 +1,93 @@
+/**
+ * @file     varlen_vector.h
+ *
+ * @brief    The Implementation of the Variable-Length Element Vector.
+ * @author   Hassan Tarek
+ */
+
+#ifndef VARLEN_VECTOR_H
+#define VARLEN_VECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Struct type declaration */
+struct varlen_vector;
+
+/* Typedefs */
+typedef struct varlen_vector varlen_vector;
+typedef uint8_t byte;
+
+#ifdef VARLEN_VECTOR_WIDE_OFFSETS
+typedef uint64_t varlen_offset;
+#else
+typedef uint32_t varlen_offset;
+#endif /* VARLEN_VECTOR_WIDE_OFFSETS */
+
+/**
+ * Define the struct represent the variable-length element vector.
+ *
+ * All the payloads are packed back to back in one byte buffer, element i
+ * occupies [offsets[i], offsets[i + 1]). The offsets are 32-bit unless
+ * VARLEN_VECTOR_WIDE_OFFSETS is defined, which lifts the 4 GiB payload limit.
+ */
+struct varlen_vector {
+    byte* data;
+    varlen_offset* offsets;
+    size_t size;
+    size_t capacity;
+    size_t data_capacity;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void varlen_vector_init(varlen_vector* vector);
+
+/* Accessing */
+const void* varlen_vector_at(const varlen_vector* vector, size_t index, size_t* length);
+size_t varlen_vector_length(const varlen_vector* vector, size_t index);
+int varlen_vector_index_of(const varlen_vector* vector, const void* val, size_t length);
+
+/* Insertion */
+void varlen_vector_push_back(varlen_vector* vector, const void* val, size_t length);
+void varlen_vector_append(varlen_vector* vector, const varlen_vector* other);
+
+/* Removal */
+void varlen_vector_pop_back(varlen_vector* vector);
+void varlen_vector_clear(varlen_vector* vector);
+void varlen_vector_destroy(varlen_vector* vector);
+
+/* Utility */
+size_t varlen_vector_size(const varlen_vector* vector);
+size_t varlen_vector_data_size(const varlen_vector* vector);
+bool varlen_vector_is_empty(const varlen_vector* vector);
+void varlen_vector_reserve(varlen_vector* vector, size_t new_capacity, size_t new_data_capacity);
+void varlen_vector_sort(varlen_vector* vector,
+                        int (* compare)(const void* lhs, size_t lhs_length, const void* rhs, size_t rhs_length));
+
+
+/* M A C R O S */
+
+#define VARLEN_VECTOR_INIT_CAPACITY 100
+#define VARLEN_VECTOR_INIT_DATA_CAPACITY 1024
+
+#define varlen_vector_for_each(index, vector_ptr) \
+    for (size_t index = 0;                        \
+         index < (vector_ptr)->size;              \
+         ++index)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* VARLEN_VECTOR_H */
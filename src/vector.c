@@ -1,5 +1,76 @@
 #include "vector.h"
 
+/**
+ * @brief Swaps two elements of the vector data.
+ *
+ * @param data The vector data.
+ * @param lhs The index of the first element.
+ * @param rhs The index of the second element.
+ * @param element_size The size in bytes of each element.
+ * @param temp A scratch block of element_size bytes.
+ */
+static void vector_swap_elements(byte* data, size_t lhs, size_t rhs, size_t element_size, byte* temp) {
+    if (lhs == rhs) {
+        return;
+    }
+    memcpy(temp, data + lhs * element_size, element_size);
+    memcpy(data + lhs * element_size, data + rhs * element_size, element_size);
+    memcpy(data + rhs * element_size, temp, element_size);
+}
+
+/**
+ * @brief Restores the max-heap order of the first count elements of data starting from root.
+ *
+ * @param data The heap data.
+ * @param root The index to sift down from.
+ * @param count The number of elements in the heap.
+ * @param element_size The size in bytes of each element.
+ * @param compare The compare function ordering the elements.
+ * @param temp A scratch block of element_size bytes.
+ */
+static void vector_sift_down(byte* data, size_t root, size_t count, size_t element_size,
+                             int (* compare)(const void* lhs, const void* rhs), byte* temp) {
+    while (true) {
+        size_t largest = root;
+        size_t left = 2 * root + 1;
+        size_t right = left + 1;
+        if (left < count && compare(data + left * element_size, data + largest * element_size) > 0) {
+            largest = left;
+        }
+        if (right < count && compare(data + right * element_size, data + largest * element_size) > 0) {
+            largest = right;
+        }
+        if (largest == root) {
+            return;
+        }
+        vector_swap_elements(data, root, largest, element_size, temp);
+        root = largest;
+    }
+}
+
+/**
+ * @brief Moves the count smallest elements of data[0, size) into a max-heap at its front in O(n log count).
+ *
+ * @param data The data to select from.
+ * @param count The number of elements to be selected, at least one.
+ * @param size The number of elements in data.
+ * @param element_size The size in bytes of each element.
+ * @param compare The compare function ordering the elements.
+ * @param temp A scratch block of element_size bytes.
+ */
+static void vector_heap_select(byte* data, size_t count, size_t size, size_t element_size,
+                               int (* compare)(const void* lhs, const void* rhs), byte* temp) {
+    for (size_t i = count / 2; i > 0; i--) {
+        vector_sift_down(data, i - 1, count, element_size, compare, temp);
+    }
+    for (size_t i = count; i < size; i++) {
+        if (compare(data + i * element_size, data) < 0) {
+            vector_swap_elements(data, 0, i, element_size, temp);
+            vector_sift_down(data, 0, count, element_size, compare, temp);
+        }
+    }
+}
+
 /**
  * @brief Initializes the vector.
  *
@@ -382,3 +453,105 @@ void vector_sort(vector* vector, int (* compare)(const void* lhs, const void* rh
     qsort(vector->data, vector->size,
           sizeof(byte) * vector->element_size,compare);
 }
+
+/**
+ * @brief Rearranges the vector so the element at nth is the one a full sort would put there,
+ *        no element before it is greater and no element after it is smaller.
+ *        Runs introselect in O(n) on average and falls back to a heap select.
+ *
+ * @param vector The vector whose data will be rearranged.
+ * @param nth The index of the element to be placed.
+ * @param compare The compare function used to order the vector, as for vector_sort.
+ */
+void vector_nth_element(vector* vector, size_t nth, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(vector != NULL && vector->data != NULL && nth < vector->size && compare != NULL);
+
+    size_t element_size = vector->element_size;
+    byte* temp = (byte *) malloc(sizeof(byte) * element_size);
+    size_t first = 0;
+    size_t last = vector->size;
+    size_t depth_limit = 0;
+    for (size_t n = vector->size; n > 1; n >>= 1) {
+        depth_limit += 2;
+    }
+
+    while (last - first > 3) {
+        byte* data = vector->data + first * element_size;
+        size_t size = last - first;
+        if (depth_limit-- == 0) {
+            vector_heap_select(data, nth - first + 1, size, element_size, compare, temp);
+            vector_swap_elements(data, 0, nth - first, element_size, temp);
+            free(temp);
+            return;
+        }
+
+        // Median of three moved to the front as the pivot.
+        size_t mid = size / 2;
+        if (compare(data + mid * element_size, data) < 0)
+            vector_swap_elements(data, 0, mid, element_size, temp);
+        if (compare(data + (size - 1) * element_size, data + mid * element_size) < 0)
+            vector_swap_elements(data, mid, size - 1, element_size, temp);
+        if (compare(data + mid * element_size, data) < 0)
+            vector_swap_elements(data, 0, mid, element_size, temp);
+        vector_swap_elements(data, 0, mid, element_size, temp);
+
+        size_t left = 0;
+        size_t right = size;
+        while (true) {
+            do {
+                left++;
+            } while (left < size && compare(data + left * element_size, data) < 0);
+            do {
+                right--;
+            } while (compare(data + right * element_size, data) > 0);
+            if (left >= right) {
+                break;
+            }
+            vector_swap_elements(data, left, right, element_size, temp);
+        }
+        vector_swap_elements(data, 0, right, element_size, temp);
+
+        size_t cut = first + right;
+        if (cut == nth) {
+            free(temp);
+            return;
+        }
+        if (nth < cut) {
+            last = cut;
+        }
+        else {
+            first = cut + 1;
+        }
+    }
+
+    for (size_t i = first + 1; i < last; i++) {
+        for (size_t j = i; j > first && compare(vector->data + (j - 1) * element_size,
+                                                vector->data + j * element_size) > 0; j--) {
+            vector_swap_elements(vector->data, j - 1, j, element_size, temp);
+        }
+    }
+    free(temp);
+}
+
+/**
+ * @brief Sorts the first count elements of the vector, they are the count smallest ones,
+ *        the rest are left in an unspecified order. Runs in O(n log count).
+ *
+ * @param vector The vector whose data will be partially sorted.
+ * @param count The number of elements to be sorted.
+ * @param compare The compare function used to order the vector, as for vector_sort.
+ */
+void vector_partial_sort(vector* vector, size_t count, int (* compare)(const void* lhs, const void* rhs)) {
+    assert(vector != NULL && vector->data != NULL && count <= vector->size && compare != NULL);
+
+    if (count == 0) {
+        return;
+    }
+    byte* temp = (byte *) malloc(sizeof(byte) * vector->element_size);
+    vector_heap_select(vector->data, count, vector->size, vector->element_size, compare, temp);
+    for (size_t end = count - 1; end > 0; end--) {
+        vector_swap_elements(vector->data, 0, end, vector->element_size, temp);
+        vector_sift_down(vector->data, 0, end, vector->element_size, compare, temp);
+    }
+    free(temp);
+}
@@ -75,6 +75,8 @@ void vector_copy_to_array(const vector* vector, void* array);
 void vector_swap(vector* lhs, vector* rhs);
 void* vector_get_data(const vector* vector);
 void vector_sort(vector* vector, int (* compare)(const void* lhs, const void* rhs));
+void vector_nth_element(vector* vector, size_t nth, int (* compare)(const void* lhs, const void* rhs));
+void vector_partial_sort(vector* vector, size_t count, int (* compare)(const void* lhs, const void* rhs));
 
 
 /* M A C R O S */
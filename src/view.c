@@ -0,0 +1,295 @@
+#include "view.h"
+
+/**
+ * @brief Initialize a stage with no source, no callbacks and no buffer.
+ *
+ * @param view The stage to be initialized.
+ * @param kind The kind of the stage.
+ * @param element_size The size in bytes of each element the stage produces.
+ */
+static void view_init_stage(view* view, view_kind kind, size_t element_size) {
+    assert(view != NULL && element_size > 0);
+
+    view->kind = kind;
+    view->element_size = element_size;
+    view->vector = NULL;
+    view->list = NULL;
+    view->source = NULL;
+    view->other = NULL;
+    view->predicate = NULL;
+    view->transformer = NULL;
+    view->zipper = NULL;
+    view->context = NULL;
+    view->begin = 0;
+    view->end = 0;
+    view->position = 0;
+    view->cursor = NULL;
+    view->buffer = NULL;
+}
+
+/**
+ * @brief Initialize a view producing the elements of the specified vector.
+ *
+ * @param view The view to be initialized.
+ * @param vector The vector to be viewed, it must outlive the view.
+ */
+void view_from_vector(view* view, const vector* vector) {
+    assert(view != NULL && vector != NULL);
+
+    view_init_stage(view, VIEW_VECTOR, vector->element_size);
+    view->vector = vector;
+}
+
+/**
+ * @brief Initialize a view producing the elements of the specified list.
+ *
+ * @param view The view to be initialized.
+ * @param list The list to be viewed, it must outlive the view.
+ */
+void view_from_list(view* view, const list* list) {
+    assert(view != NULL && list != NULL);
+
+    view_init_stage(view, VIEW_LIST, list->element_size);
+    view->list = list;
+    view->cursor = list->head;
+}
+
+/**
+ * @brief Initialize a stage producing the source elements which satisfy the predicate.
+ *
+ * @param dest The stage to be initialized.
+ * @param source The upstream stage.
+ * @param predicate The function deciding which elements are kept.
+ * @param context The user data passed to the predicate.
+ */
+void view_filter(view* dest, view* source, view_predicate predicate, void* context) {
+    assert(dest != NULL && source != NULL && predicate != NULL);
+
+    view_init_stage(dest, VIEW_FILTER, source->element_size);
+    dest->source = source;
+    dest->predicate = predicate;
+    dest->context = context;
+}
+
+/**
+ * @brief Initialize a stage producing the transformed source elements.
+ *
+ * @param dest The stage to be initialized.
+ * @param source The upstream stage.
+ * @param element_size The size in bytes of each transformed element.
+ * @param transformer The function writing the transformed element.
+ * @param context The user data passed to the transformer.
+ */
+void view_transform(view* dest, view* source, size_t element_size,
+                    view_transformer transformer, void* context) {
+    assert(dest != NULL && source != NULL && transformer != NULL);
+
+    view_init_stage(dest, VIEW_TRANSFORM, element_size);
+    dest->source = source;
+    dest->transformer = transformer;
+    dest->context = context;
+    dest->buffer = (byte *) malloc(sizeof(byte) * element_size);
+}
+
+/**
+ * @brief Initialize a stage producing the source elements in the range [begin, end).
+ *
+ * @param dest The stage to be initialized.
+ * @param source The upstream stage.
+ * @param begin The index of the first element produced.
+ * @param end The index after the last element produced.
+ */
+void view_slice(view* dest, view* source, size_t begin, size_t end) {
+    assert(dest != NULL && source != NULL && begin <= end);
+
+    view_init_stage(dest, VIEW_SLICE, source->element_size);
+    dest->source = source;
+    dest->begin = begin;
+    dest->end = end;
+}
+
+/**
+ * @brief Initialize a stage producing at most the first count source elements.
+ *
+ * @param dest The stage to be initialized.
+ * @param source The upstream stage.
+ * @param count The maximum number of elements produced.
+ */
+void view_take(view* dest, view* source, size_t count) {
+    view_slice(dest, source, 0, count);
+}
+
+/**
+ * @brief Initialize a stage combining the elements of two sources pairwise,
+ *        it stops at the end of the shorter one.
+ *
+ * @param dest The stage to be initialized.
+ * @param lhs The first upstream stage.
+ * @param rhs The second upstream stage.
+ * @param element_size The size in bytes of each combined element.
+ * @param zipper The function writing the combined element.
+ * @param context The user data passed to the zipper.
+ */
+void view_zip(view* dest, view* lhs, view* rhs, size_t element_size,
+              view_zipper zipper, void* context) {
+    assert(dest != NULL && lhs != NULL && rhs != NULL && lhs != rhs && zipper != NULL);
+
+    view_init_stage(dest, VIEW_ZIP, element_size);
+    dest->source = lhs;
+    dest->other = rhs;
+    dest->zipper = zipper;
+    dest->context = context;
+    dest->buffer = (byte *) malloc(sizeof(byte) * element_size);
+}
+
+/**
+ * @brief Rewinds the specified view and all of its sources to the first element.
+ *
+ * @param view The view to be rewound.
+ */
+void view_reset(view* view) {
+    assert(view != NULL);
+
+    view->position = 0;
+    switch (view->kind) {
+        case VIEW_VECTOR:
+            break;
+        case VIEW_LIST:
+            view->cursor = view->list->head;
+            break;
+        case VIEW_ZIP:
+            view_reset(view->other);
+            view_reset(view->source);
+            break;
+        case VIEW_SLICE:
+            view_reset(view->source);
+            if (view->source->kind == VIEW_VECTOR) {
+                // Skip the leading elements without visiting them.
+                size_t size = view->source->vector->size;
+                view->position = view->begin < size ? view->begin : size;
+                view->source->position = view->position;
+            }
+            break;
+        default:
+            view_reset(view->source);
+            break;
+    }
+}
+
+/**
+ * @brief Pulls the next element through the specified view.
+ *
+ * The returned pointer is valid until the next call on the same view.
+ *
+ * @param view The view to be advanced.
+ *
+ * @return A pointer to the next element or NULL if the view is exhausted.
+ */
+const void* view_next(view* view) {
+    assert(view != NULL);
+
+    const void* val = NULL;
+    const void* other_val = NULL;
+    switch (view->kind) {
+        case VIEW_VECTOR:
+            if (view->position < view->vector->size) {
+                val = view->vector->data + view->position * view->element_size;
+                view->position++;
+            }
+            return val;
+        case VIEW_LIST:
+            if (view->cursor != NULL) {
+                val = view->cursor->val;
+                view->cursor = view->cursor->next;
+            }
+            return val;
+        case VIEW_FILTER:
+            while ((val = view_next(view->source)) != NULL) {
+                if (view->predicate(val, view->context)) {
+                    return val;
+                }
+            }
+            return NULL;
+        case VIEW_TRANSFORM:
+            if ((val = view_next(view->source)) == NULL) {
+                return NULL;
+            }
+            view->transformer(val, view->buffer, view->context);
+            return view->buffer;
+        case VIEW_SLICE:
+            while (view->position < view->end && (val = view_next(view->source)) != NULL) {
+                if (view->position++ >= view->begin) {
+                    return val;
+                }
+            }
+            return NULL;
+        case VIEW_ZIP:
+            if ((val = view_next(view->source)) == NULL ||
+                (other_val = view_next(view->other)) == NULL) {
+                return NULL;
+            }
+            view->zipper(val, other_val, view->buffer, view->context);
+            return view->buffer;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Appends all the elements of the specified view to the dest vector in a single pass.
+ *
+ * @param view The view to be consumed.
+ * @param dest The initialized vector to append to.
+ */
+void view_collect(view* view, vector* dest) {
+    assert(view != NULL && dest != NULL && dest->element_size == view->element_size);
+
+    view_for_each(val, view) {
+        vector_push_back(dest, (void *) val);
+    }
+}
+
+/**
+ * @brief Folds all the elements of the specified view into the accumulator in a single pass.
+ *
+ * @param view The view to be consumed.
+ * @param acc A pointer to the accumulator, it holds the initial value.
+ * @param reducer The function folding an element into the accumulator.
+ * @param context The user data passed to the reducer.
+ */
+void view_reduce(view* view, void* acc, view_reducer reducer, void* context) {
+    assert(view != NULL && acc != NULL && reducer != NULL);
+
+    view_for_each(val, view) {
+        reducer(acc, val, context);
+    }
+}
+
+/**
+ * @brief Counts the elements of the specified view.
+ *
+ * @param view The view to be consumed.
+ *
+ * @return The number of elements produced by the view.
+ */
+size_t view_count(view* view) {
+    assert(view != NULL);
+
+    size_t count = 0;
+    view_reset(view);
+    while (view_next(view) != NULL) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Frees the scratch memory owned by the specified stage, its sources are left untouched.
+ *
+ * @param view A pointer to the stage to free from.
+ */
+void view_destroy(view* view) {
+    assert(view != NULL);
+
+    free(view->buffer);
+    view->buffer = NULL;
+}
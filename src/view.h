@@ -0,0 +1,113 @@
+/**
+ * @file     view.h
+ *
+ * @brief    The Implementation of Lazy Views over vectors and lists.
+ * @author   Hassan Tarek
+ */
+
+#ifndef VIEW_H
+#define VIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "vector.h"
+#include "list.h"
+
+/* Struct type declaration */
+struct view;
+
+/* Typedefs */
+typedef struct view view;
+typedef uint8_t byte;
+typedef bool (* view_predicate)(const void* val, void* context);
+typedef void (* view_transformer)(const void* val, void* dest, void* context);
+typedef void (* view_zipper)(const void* lhs, const void* rhs, void* dest, void* context);
+typedef void (* view_reducer)(void* acc, const void* val, void* context);
+
+/**
+ * Define the kinds of the pipeline stages.
+ */
+typedef enum view_kind {
+    VIEW_VECTOR,
+    VIEW_LIST,
+    VIEW_FILTER,
+    VIEW_TRANSFORM,
+    VIEW_SLICE,
+    VIEW_ZIP
+} view_kind;
+
+/**
+ * Define the struct represent one stage of a lazy pipeline.
+ *
+ * Stages are chained through their sources and nothing is evaluated
+ * until a sink pulls the elements, one element at a time, through the
+ * whole chain.
+ */
+struct view {
+    view_kind kind;
+    size_t element_size;
+    const vector* vector;
+    const list* list;
+    view* source;
+    view* other;
+    view_predicate predicate;
+    view_transformer transformer;
+    view_zipper zipper;
+    void* context;
+    size_t begin;
+    size_t end;
+    size_t position;
+    const node* cursor;
+    byte* buffer;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Sources */
+void view_from_vector(view* view, const vector* vector);
+void view_from_list(view* view, const list* list);
+
+/* Stages */
+void view_filter(view* dest, view* source, view_predicate predicate, void* context);
+void view_transform(view* dest, view* source, size_t element_size,
+                    view_transformer transformer, void* context);
+void view_slice(view* dest, view* source, size_t begin, size_t end);
+void view_take(view* dest, view* source, size_t count);
+void view_zip(view* dest, view* lhs, view* rhs, size_t element_size,
+              view_zipper zipper, void* context);
+
+/* Iteration */
+void view_reset(view* view);
+const void* view_next(view* view);
+
+/* Sinks */
+void view_collect(view* view, vector* dest);
+void view_reduce(view* view, void* acc, view_reducer reducer, void* context);
+size_t view_count(view* view);
+
+/* Removal */
+void view_destroy(view* view);
+
+
+/* M A C R O S */
+
+#define view_for_each(val_ptr, view_ptr)                                   \
+    for (const void* val_ptr = (view_reset(view_ptr), view_next(view_ptr)); \
+         val_ptr != NULL;                                                  \
+         val_ptr = view_next(view_ptr))
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* VIEW_H */
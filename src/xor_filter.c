@@ -0,0 +1,248 @@
+#include "xor_filter.h"
+
+/**
+ * @brief Compares two hashes, used to sort and deduplicate them.
+ */
+static int xor_filter_hash_comparator(const void* lhs, const void* rhs) {
+    uint64_t left = *(const uint64_t *) lhs;
+    uint64_t right = *(const uint64_t *) rhs;
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Gets the slot of the specified hash in the specified block.
+ *
+ * @param filter The filter holding the blocks.
+ * @param hash The seeded hash of the element.
+ * @param block The block index, between zero and two.
+ *
+ * @return The slot index in the fingerprints.
+ */
+static size_t xor_filter_slot(const xor_filter* filter, uint64_t hash, size_t block) {
+    uint64_t rotated = block == 0 ? hash : (hash << (21 * block)) | (hash >> (64 - 21 * block));
+    return (size_t) (((rotated & 0xffffffffULL) * filter->block_length) >> 32) + block * filter->block_length;
+}
+
+/**
+ * @brief Gets the 8-bit fingerprint of the specified hash.
+ */
+static uint8_t xor_filter_fingerprint(uint64_t hash) {
+    return (uint8_t) (hash ^ (hash >> 32));
+}
+
+/**
+ * @brief Tries to build the fingerprints with the current seed by repeatedly
+ *        peeling a slot which only one element hashes to.
+ *
+ * @param filter The filter to be built.
+ * @param keys The distinct hashes of the elements.
+ * @param size The number of hashes.
+ *
+ * @return Whether or not every element was peeled, a failure needs another seed.
+ */
+static bool xor_filter_build(xor_filter* filter, const uint64_t* keys, size_t size) {
+    size_t capacity = 3 * filter->block_length;
+    uint64_t* masks = (uint64_t *) calloc(capacity, sizeof(uint64_t));
+    uint32_t* counts = (uint32_t *) calloc(capacity, sizeof(uint32_t));
+    size_t* queue = (size_t *) malloc(sizeof(size_t) * capacity);
+    uint64_t* stack_hashes = (uint64_t *) malloc(sizeof(uint64_t) * (size + 1));
+    size_t* stack_slots = (size_t *) malloc(sizeof(size_t) * (size + 1));
+
+    for (size_t i = 0; i < size; i++) {
+        uint64_t hash = hash_mix(keys[i] + filter->seed);
+        for (size_t block = 0; block < 3; block++) {
+            size_t slot = xor_filter_slot(filter, hash, block);
+            masks[slot] ^= hash;
+            counts[slot]++;
+        }
+    }
+    size_t queue_size = 0;
+    for (size_t slot = 0; slot < capacity; slot++) {
+        if (counts[slot] == 1) {
+            queue[queue_size++] = slot;
+        }
+    }
+    size_t stack_size = 0;
+    while (queue_size > 0) {
+        size_t slot = queue[--queue_size];
+        if (counts[slot] != 1) {
+            continue;
+        }
+        uint64_t hash = masks[slot];
+        stack_hashes[stack_size] = hash;
+        stack_slots[stack_size] = slot;
+        stack_size++;
+        for (size_t block = 0; block < 3; block++) {
+            size_t other = xor_filter_slot(filter, hash, block);
+            masks[other] ^= hash;
+            counts[other]--;
+            if (counts[other] == 1) {
+                queue[queue_size++] = other;
+            }
+        }
+    }
+
+    bool built = stack_size == size;
+    if (built) {
+        memset(filter->fingerprints, 0, sizeof(uint8_t) * capacity);
+        while (stack_size > 0) {
+            stack_size--;
+            uint64_t hash = stack_hashes[stack_size];
+            filter->fingerprints[stack_slots[stack_size]] = xor_filter_fingerprint(hash)
+                    ^ filter->fingerprints[xor_filter_slot(filter, hash, 0)]
+                    ^ filter->fingerprints[xor_filter_slot(filter, hash, 1)]
+                    ^ filter->fingerprints[xor_filter_slot(filter, hash, 2)];
+        }
+    }
+    free(masks);
+    free(counts);
+    free(queue);
+    free(stack_hashes);
+    free(stack_slots);
+    return built;
+}
+
+/**
+ * @brief Initialize the xor filter with all the elements of the specified array.
+ *        Duplicated elements are allowed.
+ *
+ * @param filter The filter to be initialized.
+ * @param array The array whose elements will be added.
+ * @param array_size The number of elements in the array.
+ * @param element_size The size of each element.
+ */
+void xor_filter_init(xor_filter* filter, const void* array, size_t array_size, size_t element_size) {
+    assert(filter != NULL && (array != NULL || array_size == 0) && element_size > 0);
+
+    const byte* elements = (const byte *) array;
+    uint64_t* keys = (uint64_t *) malloc(sizeof(uint64_t) * (array_size + 1));
+    for (size_t i = 0; i < array_size; i++) {
+        keys[i] = hash_bytes(elements + i * element_size, element_size, 0);
+    }
+    qsort(keys, array_size, sizeof(uint64_t), xor_filter_hash_comparator);
+    size_t size = 0;
+    for (size_t i = 0; i < array_size; i++) {
+        if (size == 0 || keys[size - 1] != keys[i]) {
+            keys[size++] = keys[i];
+        }
+    }
+
+    filter->block_length = (32 + size + size * 23 / 100) / 3 + 1;
+    filter->fingerprints = (uint8_t *) malloc(sizeof(uint8_t) * 3 * filter->block_length);
+    filter->size = size;
+    filter->element_size = element_size;
+    filter->seed = 0;
+    do {
+        filter->seed = hash_mix(filter->seed + 0x9e3779b97f4a7c15ULL);
+    } while (!xor_filter_build(filter, keys, size));
+    free(keys);
+}
+
+/**
+ * @brief Initialize the xor filter with all the elements of the specified vector.
+ *        The filter must be rebuilt after the vector changes.
+ *
+ * @param filter The filter to be initialized.
+ * @param vector The vector whose elements will be added.
+ */
+void xor_filter_from_vector(xor_filter* filter, const vector* vector) {
+    assert(filter != NULL && vector != NULL && vector->data != NULL);
+
+    xor_filter_init(filter, vector->data, vector->size, vector->element_size);
+}
+
+/**
+ * @brief Checks whether or not the specified value may be in the filter.
+ *
+ * @param filter The filter to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return False if the value was not added, true if it probably was.
+ */
+bool xor_filter_may_contain(const xor_filter* filter, const void* val) {
+    assert(filter != NULL && filter->fingerprints != NULL && val != NULL);
+
+    uint64_t hash = hash_mix(hash_bytes(val, filter->element_size, 0) + filter->seed);
+    return xor_filter_fingerprint(hash) == (filter->fingerprints[xor_filter_slot(filter, hash, 0)]
+                                            ^ filter->fingerprints[xor_filter_slot(filter, hash, 1)]
+                                            ^ filter->fingerprints[xor_filter_slot(filter, hash, 2)]);
+}
+
+/**
+ * @brief Retrieves the index of the specified value in the vector or -1 if it's not found,
+ *        the vector is only scanned when the filter may contain the value.
+ *
+ * @param filter The filter built from the vector.
+ * @param vector The vector to be searched.
+ * @param val The value to be searched for.
+ *
+ * @return The index of the specified value or -1 if it's not found.
+ */
+int xor_filter_vector_index_of(const xor_filter* filter, const vector* vector, void* val) {
+    assert(filter != NULL && vector != NULL && filter->element_size == vector->element_size);
+
+    if (!xor_filter_may_contain(filter, val)) {
+        return -1;
+    }
+    return vector_index_of(vector, val);
+}
+
+/**
+ * @brief Frees the memory allocated for the filter.
+ *
+ * @param filter A pointer to the filter to free from.
+ */
+void xor_filter_destroy(xor_filter* filter) {
+    assert(filter != NULL);
+
+    free(filter->fingerprints);
+    filter->fingerprints = NULL;
+    filter->block_length = 0;
+    filter->size = 0;
+}
+
+/**
+ * @brief Gets the number of distinct elements in the filter.
+ *
+ * @param filter The filter whose size will be returned.
+ *
+ * @return The number of distinct elements.
+ */
+size_t xor_filter_size(const xor_filter* filter) {
+    assert(filter != NULL);
+
+    return filter->size;
+}
+
+/**
+ * @brief Gets the number of bytes used by the filter fingerprints.
+ *
+ * @param filter The filter whose memory size will be returned.
+ *
+ * @return The number of bytes of the fingerprints.
+ */
+size_t xor_filter_memory_size(const xor_filter* filter) {
+    assert(filter != NULL);
+
+    return sizeof(uint8_t) * 3 * filter->block_length;
+}
+
+/**
+ * @brief Measures the false positive rate of the filter over values known not to be added.
+ *
+ * @param filter The filter to be measured.
+ * @param absent The array of values which were never added.
+ * @param absent_size The number of values in the array.
+ *
+ * @return The fraction of the values the filter reports as maybe present.
+ */
+double xor_filter_false_positive_rate(const xor_filter* filter, const void* absent, size_t absent_size) {
+    assert(filter != NULL && absent != NULL && absent_size > 0);
+
+    const byte* elements = (const byte *) absent;
+    size_t positives = 0;
+    for (size_t i = 0; i < absent_size; i++) {
+        positives += xor_filter_may_contain(filter, elements + i * filter->element_size);
+    }
+    return (double) positives / (double) absent_size;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file     xor_filter.h
+ *
+ * @brief    The Implementation of the Static Xor Filter.
+ * @author   Hassan Tarek
+ */
+
+#ifndef XOR_FILTER_H
+#define XOR_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "hash.h"
+#include "vector.h"
+
+/* Struct type declaration */
+struct xor_filter;
+
+/* Typedefs */
+typedef struct xor_filter xor_filter;
+typedef uint8_t byte;
+
+/**
+ * Define the struct represent the static xor filter.
+ *
+ * Every element hashes to one slot in each of three blocks and the xor of
+ * the three 8-bit slots equals its fingerprint, so a lookup reads three bytes
+ * and is wrong for about 0.4% of the absent values. It uses about 9.9 bits
+ * per element but is built once from a fixed set of elements.
+ */
+struct xor_filter {
+    uint8_t* fingerprints;
+    size_t block_length;
+    size_t size;
+    size_t element_size;
+    uint64_t seed;
+};
+
+
+/** F U N C T I O N S   P R O T O T Y P E S **/
+
+/* Initialization */
+void xor_filter_init(xor_filter* filter, const void* array, size_t array_size, size_t element_size);
+void xor_filter_from_vector(xor_filter* filter, const vector* vector);
+
+/* Searching */
+bool xor_filter_may_contain(const xor_filter* filter, const void* val);
+int xor_filter_vector_index_of(const xor_filter* filter, const vector* vector, void* val);
+
+/* Removal */
+void xor_filter_destroy(xor_filter* filter);
+
+/* Utility */
+size_t xor_filter_size(const xor_filter* filter);
+size_t xor_filter_memory_size(const xor_filter* filter);
+double xor_filter_false_positive_rate(const xor_filter* filter, const void* absent, size_t absent_size);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* XOR_FILTER_H */
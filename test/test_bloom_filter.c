@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/bloom_filter.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+bloom_filter* filter_ptr;
+vector* vector_ptr;
+int absent[100000];
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_bloom_filter_init() {
+    bloom_filter_init(filter_ptr, sizeof(int), 1000, BLOOM_FILTER_BITS_PER_ELEMENT);
+    assert(filter_ptr->blocks != NULL);
+    assert(bloom_filter_size(filter_ptr) == 0);
+    assert(bloom_filter_memory_size(filter_ptr) >= 1000 * BLOOM_FILTER_BITS_PER_ELEMENT / 8);
+    int val = 5;
+    assert(bloom_filter_may_contain(filter_ptr, &val) == false);
+    bloom_filter_destroy(filter_ptr);
+    printf("test_bloom_filter_init passed!\n");
+}
+
+static void test_bloom_filter_insert() {
+    bloom_filter_init(filter_ptr, sizeof(int), 10000, BLOOM_FILTER_BITS_PER_ELEMENT);
+    for(int i = 0; i < 10000; i++) {
+        bloom_filter_insert(filter_ptr, &i);
+    }
+    assert(bloom_filter_size(filter_ptr) == 10000);
+    for(int i = 0; i < 10000; i++) {
+        assert(bloom_filter_may_contain(filter_ptr, &i) == true);
+    }
+    double rate = bloom_filter_false_positive_rate(filter_ptr, absent, 100000);
+    assert(rate < 0.02);
+    bloom_filter_clear(filter_ptr);
+    assert(bloom_filter_false_positive_rate(filter_ptr, absent, 100000) == 0.0);
+    bloom_filter_destroy(filter_ptr);
+    printf("test_bloom_filter_insert passed!\n");
+}
+
+static void test_bloom_filter_from_vector() {
+    vector_init(vector_ptr, sizeof(int));
+    for(int i = 0; i < 5000; i++) {
+        int val = 2 * i;
+        vector_push_back(vector_ptr, &val);
+    }
+    bloom_filter_from_vector(filter_ptr, vector_ptr, BLOOM_FILTER_BITS_PER_ELEMENT);
+    int val = 10000;
+    vector_push_back(vector_ptr, &val);
+    bloom_filter_insert(filter_ptr, &val);
+    for(int i = 0; i <= 5000; i++) {
+        val = 2 * i;
+        assert(bloom_filter_vector_index_of(filter_ptr, vector_ptr, &val) == i);
+        val = 2 * i + 1;
+        assert(bloom_filter_vector_index_of(filter_ptr, vector_ptr, &val) == -1);
+    }
+    bloom_filter_destroy(filter_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_bloom_filter_from_vector passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_bloom_filter_init,
+        test_bloom_filter_insert,
+        test_bloom_filter_from_vector
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    filter_ptr = (bloom_filter *) malloc(sizeof(bloom_filter));
+    vector_ptr = (vector *) malloc(sizeof(vector));
+    for(int i = 0; i < 100000; i++) {
+        absent[i] = -1 - i;
+    }
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(filter_ptr);
+    filter_ptr = NULL;
+    free(vector_ptr);
+    vector_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/bplus_tree.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+bplus_tree* tree_ptr;
+vector* keys_ptr;
+vector* values_ptr;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static void assert_ordered(const bplus_tree* tree) {
+    size_t count = 0;
+    int previous = 0;
+    bplus_tree_for_each(iterator, tree) {
+        int key = *(const int *) bplus_tree_iterator_key(&iterator);
+        assert(count == 0 || previous < key);
+        assert(*(double *) bplus_tree_iterator_value(&iterator) == key * 0.5);
+        previous = key;
+        count++;
+    }
+    assert(count == bplus_tree_size(tree));
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_bplus_tree_init() {
+    bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+    assert(bplus_tree_is_empty(tree_ptr) == true);
+    assert(bplus_tree_height(tree_ptr) == 1);
+    assert(tree_ptr->leaf_capacity >= BPLUS_TREE_MIN_CAPACITY);
+    assert(tree_ptr->inner_capacity >= BPLUS_TREE_MIN_CAPACITY);
+    bplus_tree_iterator iterator = bplus_tree_begin(tree_ptr);
+    assert(bplus_tree_iterator_is_valid(&iterator) == false);
+    bplus_tree_destroy(tree_ptr);
+    printf("test_bplus_tree_init passed!\n");
+}
+
+static void test_bplus_tree_insert() {
+    bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+    for(int i = 0; i < 10000; i++) {
+        int key = (i * 7919) % 10000;
+        double value = key * 0.5;
+        assert(bplus_tree_insert(tree_ptr, &key, &value) == true);
+    }
+    assert(bplus_tree_size(tree_ptr) == 10000);
+    assert(bplus_tree_height(tree_ptr) > 1);
+    for(int key = 0; key < 10000; key++) {
+        assert(*(double *) bplus_tree_find(tree_ptr, &key) == key * 0.5);
+    }
+    int missing = 10000;
+    assert(bplus_tree_find(tree_ptr, &missing) == NULL);
+    assert(bplus_tree_contains(tree_ptr, &missing) == false);
+    assert_ordered(tree_ptr);
+
+    int key = 42;
+    double value = 1.0;
+    assert(bplus_tree_insert(tree_ptr, &key, &value) == false);
+    assert(bplus_tree_size(tree_ptr) == 10000);
+    assert(*(double *) bplus_tree_find(tree_ptr, &key) == 1.0);
+    bplus_tree_destroy(tree_ptr);
+    printf("test_bplus_tree_insert passed!\n");
+}
+
+static void test_bplus_tree_lower_bound() {
+    bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+    for(int i = 0; i < 1000; i++) {
+        int key = 3 * i;
+        double value = key * 0.5;
+        bplus_tree_insert(tree_ptr, &key, &value);
+    }
+    int low = 100;
+    int high = 200;
+    int expected = 102;
+    for(bplus_tree_iterator iterator = bplus_tree_lower_bound(tree_ptr, &low);
+        bplus_tree_iterator_is_valid(&iterator) && *(const int *) bplus_tree_iterator_key(&iterator) < high;
+        bplus_tree_iterator_next(&iterator)) {
+        assert(*(const int *) bplus_tree_iterator_key(&iterator) == expected);
+        expected += 3;
+    }
+    assert(expected == 201);
+    int past = 3000;
+    bplus_tree_iterator iterator = bplus_tree_lower_bound(tree_ptr, &past);
+    assert(bplus_tree_iterator_is_valid(&iterator) == false);
+    bplus_tree_destroy(tree_ptr);
+    printf("test_bplus_tree_lower_bound passed!\n");
+}
+
+static void test_bplus_tree_remove() {
+    bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+    for(int key = 0; key < 5000; key++) {
+        double value = key * 0.5;
+        bplus_tree_insert(tree_ptr, &key, &value);
+    }
+    for(int i = 0; i < 5000; i++) {
+        int key = (i * 7919) % 5000;
+        assert(bplus_tree_remove(tree_ptr, &key) == true);
+        assert(bplus_tree_remove(tree_ptr, &key) == false);
+        assert(bplus_tree_size(tree_ptr) == 5000 - i - 1);
+        if (i % 500 == 0) {
+            assert_ordered(tree_ptr);
+            int next = ((i + 1) * 7919) % 5000;
+            assert(bplus_tree_contains(tree_ptr, &next) == true);
+        }
+    }
+    assert(bplus_tree_is_empty(tree_ptr) == true);
+    assert(bplus_tree_height(tree_ptr) == 1);
+    bplus_tree_destroy(tree_ptr);
+    printf("test_bplus_tree_remove passed!\n");
+}
+
+static void test_bplus_tree_bulk_load() {
+    for(int size = 0; size < 3000; size += 271) {
+        vector_init(keys_ptr, sizeof(int));
+        vector_init(values_ptr, sizeof(double));
+        for(int key = 0; key < size; key++) {
+            double value = key * 0.5;
+            vector_push_back(keys_ptr, &key);
+            vector_push_back(values_ptr, &value);
+        }
+        bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+        bplus_tree_bulk_load(tree_ptr, keys_ptr, values_ptr);
+        assert(bplus_tree_size(tree_ptr) == (size_t) size);
+        assert_ordered(tree_ptr);
+        for(int key = 0; key < size; key += 2) {
+            assert(bplus_tree_remove(tree_ptr, &key) == true);
+        }
+        for(int key = size; key < size + 100; key++) {
+            double value = key * 0.5;
+            bplus_tree_insert(tree_ptr, &key, &value);
+        }
+        assert(bplus_tree_size(tree_ptr) == (size_t) (size / 2 + 100));
+        assert_ordered(tree_ptr);
+        bplus_tree_destroy(tree_ptr);
+        vector_destroy(keys_ptr);
+        vector_destroy(values_ptr);
+    }
+    printf("test_bplus_tree_bulk_load passed!\n");
+}
+
+static void test_bplus_tree_clear() {
+    bplus_tree_init(tree_ptr, sizeof(int), sizeof(double), int_comparator);
+    for(int key = 0; key < 1000; key++) {
+        double value = key * 0.5;
+        bplus_tree_insert(tree_ptr, &key, &value);
+    }
+    bplus_tree_clear(tree_ptr);
+    assert(bplus_tree_is_empty(tree_ptr) == true);
+    int key = 7;
+    double value = 3.5;
+    bplus_tree_insert(tree_ptr, &key, &value);
+    assert(bplus_tree_size(tree_ptr) == 1);
+    assert_ordered(tree_ptr);
+    bplus_tree_destroy(tree_ptr);
+    printf("test_bplus_tree_clear passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_bplus_tree_init,
+        test_bplus_tree_insert,
+        test_bplus_tree_lower_bound,
+        test_bplus_tree_remove,
+        test_bplus_tree_bulk_load,
+        test_bplus_tree_clear
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    tree_ptr = (bplus_tree *) malloc(sizeof(bplus_tree));
+    keys_ptr = (vector *) malloc(sizeof(vector));
+    values_ptr = (vector *) malloc(sizeof(vector));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(tree_ptr);
+    tree_ptr = NULL;
+    free(keys_ptr);
+    keys_ptr = NULL;
+    free(values_ptr);
+    values_ptr = NULL;
+    return 0;
+}
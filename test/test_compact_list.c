@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/compact_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+compact_list* first_list;
+compact_list* second_list;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void assert_equals(const compact_list* list, const int* expected, size_t size) {
+    assert(compact_list_size(list) == size);
+    size_t offset = 0;
+    compact_list_for_each(position, list) {
+        assert(*(int *) compact_list_get(list, position) == expected[offset]);
+        offset++;
+    }
+    assert(offset == size);
+}
+
+static bool deserializes(compact_list* list) {
+    byte* buffer = (byte *) malloc(compact_list_serialized_size(list));
+    compact_list_serialize(list, buffer);
+    bool valid = compact_list_deserialize(second_list, buffer, compact_list_serialized_size(list));
+    assert(valid || (compact_list_is_empty(second_list) && second_list->pool == NULL));
+    compact_list_clear(second_list);
+    free(buffer);
+    return valid;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_compact_list_init() {
+    compact_list_init(first_list, sizeof(int));
+    assert(first_list->pool == NULL);
+    assert(first_list->head == COMPACT_LIST_NIL);
+    assert(first_list->node_size == 12);
+    assert(compact_list_is_empty(first_list) == true);
+    assert(compact_list_front(first_list) == NULL);
+    compact_list_clear(first_list);
+    compact_list_init(first_list, sizeof(double));
+    assert(first_list->node_size == 16);
+    compact_list_clear(first_list);
+    printf("test_compact_list_init passed!\n");
+}
+
+static void test_compact_list_push() {
+    compact_list_init(first_list, sizeof(int));
+    compact_list_push_back(first_list, &vals[0]);
+    compact_list_push_back(first_list, &vals[1]);
+    compact_list_push_front(first_list, &vals[2]);
+    compact_list_insert_at(first_list, &vals[3], 1);
+    int expected[4] = {vals[2], vals[3], vals[0], vals[1]};
+    assert_equals(first_list, expected, 4);
+    assert(*(int *) compact_list_front(first_list) == vals[2]);
+    assert(*(int *) compact_list_back(first_list) == vals[1]);
+    assert(*(int *) compact_list_at(first_list, 2) == vals[0]);
+    assert(compact_list_index_of(first_list, &vals[1]) == 3);
+    assert(compact_list_index_of(first_list, &vals[4]) == -1);
+    compact_list_clear(first_list);
+    printf("test_compact_list_push passed!\n");
+}
+
+static void test_compact_list_remove() {
+    compact_list_init(first_list, sizeof(int));
+    for (size_t i = 0; i < 6; i++) {
+        compact_list_push_back(first_list, &vals[i]);
+    }
+    compact_list_pop_front(first_list);
+    compact_list_pop_back(first_list);
+    compact_list_remove_at(first_list, 1);
+    int expected[3] = {1, 2, 4};
+    assert_equals(first_list, expected, 3);
+    compact_index next = compact_list_erase(first_list, first_list->head);
+    assert(*(int *) compact_list_get(first_list, next) == 2);
+    assert(compact_list_erase(first_list, first_list->tail) == COMPACT_LIST_NIL);
+    assert(compact_list_size(first_list) == 1);
+    compact_list_clear(first_list);
+    printf("test_compact_list_remove passed!\n");
+}
+
+static void test_compact_list_reuse() {
+    compact_list_init(first_list, sizeof(int));
+    compact_list_reserve(first_list, 100);
+    for (int i = 0; i < 100; i++) {
+        compact_list_push_back(first_list, &i);
+    }
+    byte* pool = first_list->pool;
+    for (int i = 100; i < 10000; i++) {
+        compact_list_pop_front(first_list);
+        compact_list_push_back(first_list, &i);
+    }
+    assert(first_list->pool == pool);
+    assert(compact_list_capacity(first_list) == 100);
+    assert(*(int *) compact_list_front(first_list) == 9900);
+    for (int i = 0; i < 1000; i++) {
+        compact_list_push_front(first_list, &i);
+    }
+    assert(compact_list_size(first_list) == 1100);
+    assert(*(int *) compact_list_at(first_list, 0) == 999);
+    assert(*(int *) compact_list_at(first_list, 1099) == 9999);
+    compact_list_clear(first_list);
+    printf("test_compact_list_reuse passed!\n");
+}
+
+static void test_compact_list_copy() {
+    compact_list_init(first_list, sizeof(int));
+    for (int i = 0; i < 500; i++) {
+        compact_list_insert_at(first_list, &i, (size_t) i / 2);
+    }
+    compact_list_copy(first_list, second_list);
+    int* expected = (int *) malloc(sizeof(int) * 500);
+    compact_list_copy_to_array(first_list, expected);
+    compact_list_clear(first_list);
+    assert_equals(second_list, expected, 500);
+    compact_list_push_back(second_list, &vals[0]);
+    assert(*(int *) compact_list_back(second_list) == vals[0]);
+    compact_list_clear(second_list);
+    free(expected);
+    printf("test_compact_list_copy passed!\n");
+}
+
+static void test_compact_list_serialize() {
+    compact_list_init(first_list, sizeof(int));
+    for (int i = 0; i < 300; i++) {
+        compact_list_push_front(first_list, &i);
+    }
+    for (size_t i = 0; i < 100; i++) {
+        compact_list_remove_at(first_list, i);
+    }
+    size_t size = compact_list_serialized_size(first_list);
+    byte* buffer = (byte *) malloc(size);
+    compact_list_serialize(first_list, buffer);
+    int* expected = (int *) malloc(sizeof(int) * 200);
+    compact_list_copy_to_array(first_list, expected);
+    compact_list_clear(first_list);
+
+    assert(compact_list_deserialize(second_list, buffer, size - 1) == false);
+    assert(compact_list_deserialize(second_list, buffer, size) == true);
+    assert_equals(second_list, expected, 200);
+    compact_list_pop_front(second_list);
+    compact_list_push_back(second_list, &vals[0]);
+    assert(*(int *) compact_list_at(second_list, 198) == expected[199]);
+    assert(*(int *) compact_list_back(second_list) == vals[0]);
+    compact_list_clear(second_list);
+    free(expected);
+    free(buffer);
+    printf("test_compact_list_serialize passed!\n");
+}
+
+static void test_compact_list_deserialize_corrupted() {
+    compact_list_init(first_list, sizeof(int));
+    for (int i = 0; i < 10; i++) {
+        compact_list_push_back(first_list, &i);
+    }
+    compact_list_pop_front(first_list);
+    compact_list_pop_back(first_list);
+    assert(deserializes(first_list) == true);
+    compact_index head = first_list->head;
+    first_list->head = 100000;
+    assert(deserializes(first_list) == false);
+    first_list->head = head;
+    compact_index tail = first_list->tail;
+    first_list->tail = compact_list_node(first_list, tail)->prev;
+    assert(deserializes(first_list) == false);
+    first_list->tail = tail;
+    compact_index next = compact_list_node(first_list, head)->next;
+    compact_list_node(first_list, head)->next = head;
+    assert(deserializes(first_list) == false);
+    compact_list_node(first_list, head)->next = next;
+    compact_index free_head = first_list->free_head;
+    first_list->free_head = head;
+    assert(deserializes(first_list) == false);
+    first_list->free_head = free_head;
+    compact_list_node(first_list, free_head)->next = free_head;
+    assert(deserializes(first_list) == false);
+    compact_list_clear(first_list);
+
+    /* A header whose used times node_size wraps around to the 16 bytes of payload following it */
+    uint64_t overflowing[7] = {(uint64_t) 1 << 63, ((uint64_t) 1 << 63) + 8, 0, 0, 0, 0, 0};
+    compact_index indices[6] = {1, 1, COMPACT_LIST_NIL, 1, 2, 0};
+    memcpy(&overflowing[2], indices, sizeof(indices));
+    assert(compact_list_deserialize(second_list, overflowing, sizeof(overflowing)) == false);
+    printf("test_compact_list_deserialize_corrupted passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_compact_list_init,
+        test_compact_list_push,
+        test_compact_list_remove,
+        test_compact_list_reuse,
+        test_compact_list_copy,
+        test_compact_list_serialize,
+        test_compact_list_deserialize_corrupted
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    first_list = (compact_list *) malloc(sizeof(compact_list));
+    second_list = (compact_list *) malloc(sizeof(compact_list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(first_list);
+    first_list = NULL;
+    free(second_list);
+    second_list = NULL;
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/external_sort.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+external_sort* sort_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+int rets[6];
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static bool collect(const void* val, void* context) {
+    vector_push_back((vector *) context, (void *) val);
+    return true;
+}
+
+static bool stop_after_two(const void* val, void* context) {
+    return ++*(int *) context < 2;
+}
+
+static int pseudo_random(int i) {
+    return (int) ((i * 2654435761u) % 100003u);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_external_sort_in_memory() {
+    external_sort_init(sort_ptr, sizeof(int), 1024, int_comparator);
+    assert(external_sort_push_array(sort_ptr, vals, 6) == true);
+    assert(external_sort_size(sort_ptr) == 6);
+    assert(external_sort_run_count(sort_ptr) == 0);
+    vector sorted;
+    vector_init(&sorted, sizeof(int));
+    assert(external_sort_finish(sort_ptr, collect, &sorted) == true);
+    vector_copy_to_array(&sorted, rets);
+    for(int i = 0; i < 6; i++) {
+        assert(rets[i] == i + 1);
+    }
+    vector_destroy(&sorted);
+    external_sort_destroy(sort_ptr);
+    printf("test_external_sort_in_memory passed!\n");
+}
+
+static void test_external_sort_runs() {
+    const int count = 10000;
+    external_sort_init(sort_ptr, sizeof(int), 256 * sizeof(int), int_comparator);
+    for(int i = 0; i < count; i++) {
+        int val = pseudo_random(i);
+        assert(external_sort_push(sort_ptr, &val) == true);
+    }
+    assert(external_sort_run_count(sort_ptr) == count / 256);
+    vector sorted;
+    vector_init(&sorted, sizeof(int));
+    assert(external_sort_finish(sort_ptr, collect, &sorted) == true);
+    assert(vector_size(&sorted) == count);
+    int* data = (int *) vector_get_data(&sorted);
+    for(int i = 1; i < count; i++) {
+        assert(data[i - 1] <= data[i]);
+    }
+    vector_destroy(&sorted);
+    external_sort_destroy(sort_ptr);
+    printf("test_external_sort_runs passed!\n");
+}
+
+static void test_external_sort_stop() {
+    external_sort_init(sort_ptr, sizeof(int), 2 * sizeof(int), int_comparator);
+    external_sort_push_array(sort_ptr, vals, 6);
+    int calls = 0;
+    assert(external_sort_finish(sort_ptr, stop_after_two, &calls) == false);
+    assert(calls == 2);
+    external_sort_destroy(sort_ptr);
+    printf("test_external_sort_stop passed!\n");
+}
+
+static void test_external_sort_file() {
+    const int count = 5000;
+    const char* input_path = "external_sort_input.bin";
+    const char* output_path = "external_sort_output.bin";
+    FILE* input = fopen(input_path, "wb");
+    assert(input != NULL);
+    for(int i = 0; i < count; i++) {
+        int val = pseudo_random(i);
+        fwrite(&val, sizeof(int), 1, input);
+    }
+    fclose(input);
+    assert(external_sort_file(input_path, output_path, sizeof(int), 100 * sizeof(int), int_comparator) == true);
+    FILE* output = fopen(output_path, "rb");
+    assert(output != NULL);
+    int prev = -1;
+    int val;
+    int read = 0;
+    while(fread(&val, sizeof(int), 1, output) == 1) {
+        assert(prev <= val);
+        prev = val;
+        read++;
+    }
+    assert(read == count);
+    fclose(output);
+    remove(input_path);
+    remove(output_path);
+    assert(external_sort_file("missing_external_sort_input.bin", output_path, sizeof(int),
+                              100 * sizeof(int), int_comparator) == false);
+    printf("test_external_sort_file passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_external_sort_in_memory,
+        test_external_sort_runs,
+        test_external_sort_stop,
+        test_external_sort_file
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    sort_ptr = (external_sort *) malloc(sizeof(external_sort));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(sort_ptr);
+    sort_ptr = NULL;
+    return 0;
+}
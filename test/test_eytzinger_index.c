@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/eytzinger_index.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+eytzinger_index* index_ptr;
+vector* vector_ptr;
+int vals[6] = {1, 2, 4, 4, 8, 16};
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static size_t linear_lower_bound(const int* data, size_t size, int key) {
+    size_t i = 0;
+    while (i < size && data[i] < key) {
+        i++;
+    }
+    return i;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_eytzinger_index_init() {
+    vector_init(vector_ptr, sizeof(int));
+    vector_append_array(vector_ptr, vals, 6);
+    eytzinger_index_init(index_ptr, vector_ptr, int_comparator);
+    assert(eytzinger_index_size(index_ptr) == 6);
+    assert(index_ptr->element_size == sizeof(int));
+    assert(*(int *) (index_ptr->data + sizeof(int)) == vals[index_ptr->ranks[1]]);
+    eytzinger_index_destroy(index_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_eytzinger_index_init passed!\n");
+}
+
+static void test_eytzinger_index_lower_bound() {
+    vector_init(vector_ptr, sizeof(int));
+    vector_append_array(vector_ptr, vals, 6);
+    eytzinger_index_init(index_ptr, vector_ptr, int_comparator);
+    for(int key = -1; key < 20; key++) {
+        assert(eytzinger_index_lower_bound(index_ptr, &key) == linear_lower_bound(vals, 6, key));
+    }
+    eytzinger_index_destroy(index_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_eytzinger_index_lower_bound passed!\n");
+}
+
+static void test_eytzinger_index_lower_bound_batch() {
+    for(int size = 0; size < 70; size++) {
+        vector_init(vector_ptr, sizeof(int));
+        for(int i = 0; i < size; i++) {
+            int val = 3 * i;
+            vector_push_back(vector_ptr, &val);
+        }
+        eytzinger_index_init(index_ptr, vector_ptr, int_comparator);
+        int keys[220];
+        size_t results[220];
+        for(int i = 0; i < 220; i++) {
+            keys[i] = i - 5;
+        }
+        eytzinger_index_lower_bound_batch(index_ptr, keys, 220, results);
+        for(int i = 0; i < 220; i++) {
+            size_t expected = linear_lower_bound(vector_get_data(vector_ptr), size, keys[i]);
+            assert(results[i] == expected);
+            assert(eytzinger_index_lower_bound(index_ptr, &keys[i]) == expected);
+        }
+        eytzinger_index_destroy(index_ptr);
+        vector_destroy(vector_ptr);
+    }
+    printf("test_eytzinger_index_lower_bound_batch passed!\n");
+}
+
+static void test_eytzinger_index_contains() {
+    vector_init(vector_ptr, sizeof(int));
+    vector_append_array(vector_ptr, vals, 6);
+    eytzinger_index_init(index_ptr, vector_ptr, int_comparator);
+    for(size_t i = 0; i < 6; i++) {
+        assert(eytzinger_index_contains(index_ptr, &vals[i]) == true);
+    }
+    int missing[] = {0, 3, 5, 17};
+    for(size_t i = 0; i < 4; i++) {
+        assert(eytzinger_index_contains(index_ptr, &missing[i]) == false);
+    }
+    eytzinger_index_destroy(index_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_eytzinger_index_contains passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_eytzinger_index_init,
+        test_eytzinger_index_lower_bound,
+        test_eytzinger_index_lower_bound_batch,
+        test_eytzinger_index_contains
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    index_ptr = (eytzinger_index *) malloc(sizeof(eytzinger_index));
+    vector_ptr = (vector *) malloc(sizeof(vector));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(index_ptr);
+    index_ptr = NULL;
+    free(vector_ptr);
+    vector_ptr = NULL;
+    return 0;
+}
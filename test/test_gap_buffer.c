@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/gap_buffer.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+gap_buffer* buffer_ptr;
+vector* vector_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+int rets[6];
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_gap_buffer_init() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    assert(buffer_ptr->data != NULL);
+    assert(buffer_ptr->gap_start == 0);
+    assert(buffer_ptr->gap_end == GAP_BUFFER_INIT_CAPACITY);
+    assert(buffer_ptr->capacity == GAP_BUFFER_INIT_CAPACITY);
+    assert(buffer_ptr->element_size == sizeof(int));
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_init passed!\n");
+}
+
+static void test_gap_buffer_insert() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        gap_buffer_insert(buffer_ptr, &vals[i]);
+    }
+    assert(gap_buffer_size(buffer_ptr) == 6);
+    assert(gap_buffer_cursor(buffer_ptr) == 6);
+    gap_buffer_for_each(index, buffer_ptr) {
+        gap_buffer_at(buffer_ptr, index, &rets[0]);
+        assert(rets[0] == vals[index]);
+    }
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_insert passed!\n");
+}
+
+static void test_gap_buffer_move_cursor() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    gap_buffer_insert(buffer_ptr, &vals[0]);
+    gap_buffer_insert(buffer_ptr, &vals[1]);
+    gap_buffer_move_cursor(buffer_ptr, 1);
+    gap_buffer_insert(buffer_ptr, &vals[2]);
+    gap_buffer_insert(buffer_ptr, &vals[3]);
+    gap_buffer_move_cursor(buffer_ptr, 0);
+    gap_buffer_insert(buffer_ptr, &vals[4]);
+    gap_buffer_copy_to_array(buffer_ptr, rets);
+    assert(rets[0] == vals[4]);
+    assert(rets[1] == vals[0]);
+    assert(rets[2] == vals[2]);
+    assert(rets[3] == vals[3]);
+    assert(rets[4] == vals[1]);
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_move_cursor passed!\n");
+}
+
+static void test_gap_buffer_insert_at() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    gap_buffer_insert_at(buffer_ptr, &vals[0], 0);
+    gap_buffer_insert_at(buffer_ptr, &vals[1], 0);
+    gap_buffer_insert_at(buffer_ptr, &vals[2], 2);
+    gap_buffer_insert_at(buffer_ptr, &vals[3], 1);
+    gap_buffer_copy_to_array(buffer_ptr, rets);
+    assert(rets[0] == vals[1]);
+    assert(rets[1] == vals[3]);
+    assert(rets[2] == vals[0]);
+    assert(rets[3] == vals[2]);
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_insert_at passed!\n");
+}
+
+static void test_gap_buffer_erase() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        gap_buffer_insert(buffer_ptr, &vals[i]);
+    }
+    gap_buffer_move_cursor(buffer_ptr, 3);
+    gap_buffer_erase_before(buffer_ptr);
+    gap_buffer_erase_after(buffer_ptr);
+    gap_buffer_remove_at(buffer_ptr, 0);
+    assert(gap_buffer_size(buffer_ptr) == 3);
+    gap_buffer_copy_to_array(buffer_ptr, rets);
+    assert(rets[0] == vals[1]);
+    assert(rets[1] == vals[4]);
+    assert(rets[2] == vals[5]);
+    gap_buffer_clear(buffer_ptr);
+    assert(gap_buffer_is_empty(buffer_ptr) == true);
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_erase passed!\n");
+}
+
+static void test_gap_buffer_reserve() {
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    for(int i = 0; i < 1000; i++) {
+        gap_buffer_insert_at(buffer_ptr, &i, gap_buffer_size(buffer_ptr) / 2);
+    }
+    assert(gap_buffer_size(buffer_ptr) == 1000);
+    assert(buffer_ptr->capacity >= 1000);
+    gap_buffer_move_cursor(buffer_ptr, 10);
+    gap_buffer_reserve(buffer_ptr, 1000);
+    assert(buffer_ptr->capacity == 1000);
+    assert(gap_buffer_cursor(buffer_ptr) == 10);
+    gap_buffer_at(buffer_ptr, 499, &rets[0]);
+    assert(rets[0] == 999);
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_reserve passed!\n");
+}
+
+static void test_gap_buffer_from_vector() {
+    vector_init(vector_ptr, sizeof(int));
+    vector_append_array(vector_ptr, vals, 6);
+    size_t capacity = vector_capacity(vector_ptr);
+    gap_buffer_from_vector(buffer_ptr, vector_ptr);
+    assert(vector_ptr->data == NULL);
+    assert(gap_buffer_size(buffer_ptr) == 6);
+    assert(gap_buffer_cursor(buffer_ptr) == 6);
+    assert(buffer_ptr->capacity == capacity);
+    gap_buffer_at(buffer_ptr, 5, &rets[0]);
+    assert(rets[0] == vals[5]);
+    gap_buffer_destroy(buffer_ptr);
+    printf("test_gap_buffer_from_vector passed!\n");
+}
+
+static void test_gap_buffer_to_vector() {
+    vector_init(vector_ptr, sizeof(int));
+    gap_buffer_init(buffer_ptr, sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        gap_buffer_insert(buffer_ptr, &vals[i]);
+    }
+    gap_buffer_move_cursor(buffer_ptr, 2);
+    gap_buffer_to_vector(buffer_ptr, vector_ptr);
+    assert(buffer_ptr->data == NULL);
+    assert(vector_size(vector_ptr) == 6);
+    vector_copy_to_array(vector_ptr, rets);
+    for(size_t i = 0; i < 6; i++) {
+        assert(rets[i] == vals[i]);
+    }
+    vector_destroy(vector_ptr);
+    printf("test_gap_buffer_to_vector passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_gap_buffer_init,
+        test_gap_buffer_insert,
+        test_gap_buffer_move_cursor,
+        test_gap_buffer_insert_at,
+        test_gap_buffer_erase,
+        test_gap_buffer_reserve,
+        test_gap_buffer_from_vector,
+        test_gap_buffer_to_vector
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    buffer_ptr = (gap_buffer *) malloc(sizeof(gap_buffer));
+    vector_ptr = (vector *) malloc(sizeof(vector));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(buffer_ptr);
+    buffer_ptr = NULL;
+    free(vector_ptr);
+    vector_ptr = NULL;
+    return 0;
+}
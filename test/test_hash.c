@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/hash.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_hash_bytes() {
+    const char* text = "The quick brown fox";
+    size_t length = strlen(text);
+    assert(hash_bytes(text, length, 0) == hash_bytes(text, length, 0));
+    assert(hash_bytes(text, length, 0) != hash_bytes(text, length, 1));
+    assert(hash_bytes(text, length, 0) != hash_bytes(text, length - 1, 0));
+    assert(hash_bytes(NULL, 0, 0) != hash_bytes(NULL, 0, 1));
+    int zero = 0;
+    long long wide_zero = 0;
+    assert(hash_bytes(&zero, sizeof(int), 0) != hash_bytes(&wide_zero, sizeof(long long), 0));
+    printf("test_hash_bytes passed!\n");
+}
+
+static void test_hash_bytes_spread() {
+    size_t buckets[64] = {0};
+    for(int i = 0; i < 64000; i++) {
+        buckets[hash_bytes(&i, sizeof(int), 0) >> 58]++;
+    }
+    for(size_t i = 0; i < 64; i++) {
+        assert(buckets[i] > 800 && buckets[i] < 1200);
+    }
+    printf("test_hash_bytes_spread passed!\n");
+}
+
+static void test_hash_mix() {
+    assert(hash_mix(1) != hash_mix(2));
+    assert(hash_mix(1) != 1);
+    printf("test_hash_mix passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_hash_bytes,
+        test_hash_bytes_spread,
+        test_hash_mix
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/intrusive_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Struct type declaration */
+typedef struct item {
+    int val;
+    list_hook all_hook;
+    list_hook even_hook;
+} item;
+
+/* Global Variables */
+intrusive_list* list_ptrs[2];
+item items[6];
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void reset_items() {
+    for(int i = 0; i < 6; i++) {
+        items[i].val = i;
+        list_hook_init(&items[i].all_hook);
+        list_hook_init(&items[i].even_hook);
+    }
+}
+
+static void assert_vals(const intrusive_list* list, const int* expected, size_t size) {
+    assert(intrusive_list_size(list) == size);
+    size_t offset = 0;
+    intrusive_list_for_each(hook, list) {
+        assert(intrusive_list_entry(hook, item, all_hook)->val == expected[offset]);
+        offset++;
+    }
+    assert(offset == size);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_intrusive_list_init() {
+    intrusive_list_init(list_ptrs[0]);
+    assert(intrusive_list_is_empty(list_ptrs[0]) == true);
+    assert(intrusive_list_front(list_ptrs[0]) == NULL);
+    assert(intrusive_list_back(list_ptrs[0]) == NULL);
+    printf("test_intrusive_list_init passed!\n");
+}
+
+static void test_intrusive_list_push() {
+    reset_items();
+    intrusive_list_init(list_ptrs[0]);
+    intrusive_list_push_back(list_ptrs[0], &items[1].all_hook);
+    intrusive_list_push_back(list_ptrs[0], &items[2].all_hook);
+    intrusive_list_push_front(list_ptrs[0], &items[0].all_hook);
+    intrusive_list_insert_before(list_ptrs[0], &items[2].all_hook, &items[3].all_hook);
+    int expected[4] = {0, 1, 3, 2};
+    assert_vals(list_ptrs[0], expected, 4);
+    assert(intrusive_list_entry(intrusive_list_back(list_ptrs[0]), item, all_hook) == &items[2]);
+    assert(list_hook_is_linked(&items[3].all_hook) == true);
+    assert(list_hook_is_linked(&items[4].all_hook) == false);
+    intrusive_list_clear(list_ptrs[0]);
+    assert(list_hook_is_linked(&items[0].all_hook) == false);
+    printf("test_intrusive_list_push passed!\n");
+}
+
+static void test_intrusive_list_unlink() {
+    reset_items();
+    intrusive_list_init(list_ptrs[0]);
+    for(int i = 0; i < 6; i++) {
+        intrusive_list_push_back(list_ptrs[0], &items[i].all_hook);
+    }
+    intrusive_list_unlink(list_ptrs[0], &items[3].all_hook);
+    assert(intrusive_list_pop_front(list_ptrs[0]) == &items[0].all_hook);
+    assert(intrusive_list_pop_back(list_ptrs[0]) == &items[5].all_hook);
+    int expected[3] = {1, 2, 4};
+    assert_vals(list_ptrs[0], expected, 3);
+    intrusive_list_for_each_safe(hook, list_ptrs[0]) {
+        if (intrusive_list_entry(hook, item, all_hook)->val % 2 == 0) {
+            intrusive_list_unlink(list_ptrs[0], hook);
+        }
+    }
+    int odd[1] = {1};
+    assert_vals(list_ptrs[0], odd, 1);
+    intrusive_list_clear(list_ptrs[0]);
+    printf("test_intrusive_list_unlink passed!\n");
+}
+
+static void test_intrusive_list_several_lists() {
+    reset_items();
+    intrusive_list_init(list_ptrs[0]);
+    intrusive_list_init(list_ptrs[1]);
+    for(int i = 0; i < 6; i++) {
+        intrusive_list_push_back(list_ptrs[0], &items[i].all_hook);
+        if (i % 2 == 0) {
+            intrusive_list_push_front(list_ptrs[1], &items[i].even_hook);
+        }
+    }
+    int expected[3] = {4, 2, 0};
+    size_t offset = 0;
+    intrusive_list_for_each(hook, list_ptrs[1]) {
+        assert(intrusive_list_entry(hook, item, even_hook)->val == expected[offset]);
+        offset++;
+    }
+    intrusive_list_unlink(list_ptrs[0], &items[2].all_hook);
+    assert(intrusive_list_size(list_ptrs[0]) == 5);
+    assert(intrusive_list_size(list_ptrs[1]) == 3);
+    assert(list_hook_is_linked(&items[2].even_hook) == true);
+    intrusive_list_clear(list_ptrs[0]);
+    intrusive_list_clear(list_ptrs[1]);
+    printf("test_intrusive_list_several_lists passed!\n");
+}
+
+static void test_intrusive_list_splice() {
+    reset_items();
+    intrusive_list_init(list_ptrs[0]);
+    intrusive_list_init(list_ptrs[1]);
+    for(int i = 0; i < 3; i++) {
+        intrusive_list_push_back(list_ptrs[0], &items[i].all_hook);
+        intrusive_list_push_back(list_ptrs[1], &items[i + 3].all_hook);
+    }
+    intrusive_list_splice(list_ptrs[0], &items[1].all_hook, list_ptrs[1]);
+    int expected[6] = {0, 3, 4, 5, 1, 2};
+    assert_vals(list_ptrs[0], expected, 6);
+    assert(intrusive_list_is_empty(list_ptrs[1]) == true);
+    intrusive_list_splice(list_ptrs[1], &list_ptrs[1]->sentinel, list_ptrs[0]);
+    assert_vals(list_ptrs[1], expected, 6);
+    intrusive_list_clear(list_ptrs[1]);
+    printf("test_intrusive_list_splice passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_intrusive_list_init,
+        test_intrusive_list_push,
+        test_intrusive_list_unlink,
+        test_intrusive_list_several_lists,
+        test_intrusive_list_splice
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    size_t lists_size = sizeof(list_ptrs) / sizeof(list_ptrs[0]);
+    for(size_t i = 0; i < lists_size; i++) {
+        list_ptrs[i] = (intrusive_list *) malloc(sizeof(intrusive_list));
+    }
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    for(size_t i = 0; i < lists_size; i++) {
+        free(list_ptrs[i]);
+        list_ptrs[i] = NULL;
+    }
+    return 0;
+}
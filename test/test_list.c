@@ -258,31 +258,394 @@ static void test_list_copy_to_array() {
     printf("test_list_copy_to_array passed!\n");
 }
 
-static int compare_nodes(const void* left, const void* right) {
-    const node* left_node = *(const node**) left;
-    const node* right_node = *(const node**) right;
-
-    int left_val = *(int*) (left_node->val);
-    int right_val = *(int*) (right_node->val);
+static int compare_ints(const void* left, const void* right) {
+    int left_val = *(const int *) left;
+    int right_val = *(const int *) right;
 
     return left_val - right_val;
 }
 
+static int compare_keys(const void* left, const void* right) {
+    return *(const int *) left / 10000 - *(const int *) right / 10000;
+}
+
 static void test_list_sort() {
     list_init(list_ptrs[0], sizeof(int));
     for (size_t i = 0; i < sizeof(vals) / sizeof(vals[0]); i++) {
         list_push_back(list_ptrs[0], &vals[i]);
     }
-    list_sort(list_ptrs[0], compare_nodes);
+    list_sort(list_ptrs[0], compare_ints);
     list_for_each(node, list_ptrs[0]) {
         if (node->prev) {
             assert(*(int *) node->prev->val <= *(int *) node->val);
         }
     }
+    assert(*(int *) list_front(list_ptrs[0])->val == 1);
+    assert(*(int *) list_back(list_ptrs[0])->val == 6);
+    list_clear(list_ptrs[0]);
+
+    list_init(list_ptrs[0], sizeof(int));
+    for (int i = 0; i < 10000; i++) {
+        int val = (i * 7919) % 1000 * 10000 + i;
+        list_push_back(list_ptrs[0], &val);
+    }
+    list_sort(list_ptrs[0], compare_keys);
+    size_t count = 0;
+    list_for_each_reverse(node, list_ptrs[0]) {
+        count++;
+        if (node->prev) {
+            assert(*(int *) node->prev->val < *(int *) node->val);
+        }
+    }
+    assert(count == 10000);
     list_clear(list_ptrs[0]);
     printf("test_list_sort passed!\n");
 }
 
+static void test_list_reserve() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_reserve(list_ptrs[0], 100);
+    assert(list_capacity(list_ptrs[0]) == 100);
+    assert(list_ptrs[0]->slabs_size == 1);
+    for (int i = 0; i < 100; i++) {
+        list_push_back(list_ptrs[0], &i);
+    }
+    for (int i = 0; i < 1000; i++) {
+        list_pop_front(list_ptrs[0]);
+        list_push_back(list_ptrs[0], &i);
+    }
+    assert(list_capacity(list_ptrs[0]) == 100);
+    assert(list_ptrs[0]->slabs_size == 1);
+    assert(*(int *) list_front(list_ptrs[0])->val == 900);
+    list_push_back(list_ptrs[0], &vals[0]);
+    assert(list_capacity(list_ptrs[0]) == 200);
+    assert(list_ptrs[0]->slabs_size == 2);
+    list_clear(list_ptrs[0]);
+    assert(list_capacity(list_ptrs[0]) == 0);
+    assert(list_ptrs[0]->slabs == NULL);
+    printf("test_list_reserve passed!\n");
+}
+
+static void test_list_node_reuse() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_push_back(list_ptrs[0], &vals[0]);
+    list_push_back(list_ptrs[0], &vals[1]);
+    node* removed = list_back(list_ptrs[0]);
+    list_pop_back(list_ptrs[0]);
+    list_push_front(list_ptrs[0], &vals[2]);
+    assert(list_front(list_ptrs[0]) == removed);
+    assert(*(int *) removed->val == vals[2]);
+    assert(list_capacity(list_ptrs[0]) == LIST_SLAB_MIN_NODES);
+    list_clear(list_ptrs[0]);
+    printf("test_list_node_reuse passed!\n");
+}
+
+static void test_list_free_slabs() {
+    list_init(list_ptrs[0], sizeof(int));
+    for (int i = 0; i < 20000; i++) {
+        list_push_back(list_ptrs[0], &i);
+    }
+    size_t slabs_size = list_ptrs[0]->slabs_size;
+    size_t capacity = list_capacity(list_ptrs[0]);
+    for (int i = 0; i < LIST_SLAB_MIN_NODES - 1; i++) {
+        list_pop_front(list_ptrs[0]);
+    }
+    assert(list_ptrs[0]->slabs_size == slabs_size);
+    list_pop_front(list_ptrs[0]);
+    assert(list_ptrs[0]->slabs_size == slabs_size - 1);
+    assert(list_capacity(list_ptrs[0]) == capacity - LIST_SLAB_MIN_NODES);
+    while (!list_is_empty(list_ptrs[0])) {
+        list_pop_back(list_ptrs[0]);
+    }
+    assert(list_ptrs[0]->slabs_size == 1);
+    assert(list_capacity(list_ptrs[0]) <= LIST_SLAB_MAX_NODES);
+    size_t free_nodes = 0;
+    for (node* cur = list_ptrs[0]->free_nodes; cur != NULL; cur = cur->next) {
+        assert(cur->slab == list_ptrs[0]->slabs);
+        free_nodes++;
+    }
+    assert(free_nodes <= list_capacity(list_ptrs[0]));
+    for (int i = 0; i < 100; i++) {
+        list_push_back(list_ptrs[0], &i);
+    }
+    assert(list_ptrs[0]->slabs_size == 1);
+    list_clear(list_ptrs[0]);
+    printf("test_list_free_slabs passed!\n");
+}
+
+static void test_list_insert_before_after() {
+    list_init(list_ptrs[0], sizeof(int));
+    node* middle = list_insert_before(list_ptrs[0], NULL, &vals[0]);
+    node* first = list_insert_before(list_ptrs[0], middle, &vals[1]);
+    node* last = list_insert_after(list_ptrs[0], middle, &vals[2]);
+    list_insert_after(list_ptrs[0], NULL, &vals[3]);
+    list_insert_after(list_ptrs[0], last, &vals[4]);
+    int expected[5] = {vals[3], vals[1], vals[0], vals[2], vals[4]};
+    size_t offset = 0;
+    list_for_each(node, list_ptrs[0]) {
+        assert(*(int *) node->val == expected[offset]);
+        offset++;
+    }
+    assert(list_size(list_ptrs[0]) == 5);
+    assert(first->prev == list_front(list_ptrs[0]));
+    assert(*(int *) list_back(list_ptrs[0])->val == vals[4]);
+    list_clear(list_ptrs[0]);
+    printf("test_list_insert_before_after passed!\n");
+}
+
+static void test_list_erase() {
+    list_init(list_ptrs[0], sizeof(int));
+    for (size_t i = 0; i < 6; i++) {
+        list_push_back(list_ptrs[0], &vals[i]);
+    }
+    node* cur = list_front(list_ptrs[0]);
+    while (cur != NULL) {
+        cur = *(int *) cur->val % 2 == 0 ? list_erase(list_ptrs[0], cur) : cur->next;
+    }
+    int expected[3] = {1, 5, 3};
+    size_t offset = 0;
+    list_for_each(node, list_ptrs[0]) {
+        assert(*(int *) node->val == expected[offset]);
+        offset++;
+    }
+    assert(list_erase(list_ptrs[0], list_back(list_ptrs[0])) == NULL);
+    assert(list_size(list_ptrs[0]) == 2);
+    list_clear(list_ptrs[0]);
+    printf("test_list_erase passed!\n");
+}
+
+static void test_list_cursor() {
+    list_init(list_ptrs[0], sizeof(int));
+    for (size_t i = 0; i < 6; i++) {
+        list_push_back(list_ptrs[0], &vals[i]);
+    }
+    list_cursor cursor = list_cursor_front(list_ptrs[0]);
+    while (list_cursor_is_valid(&cursor)) {
+        int val = *(int *) list_cursor_get(&cursor);
+        if (val > 4) {
+            list_cursor_erase(&cursor);
+        }
+        else {
+            int doubled = 2 * val;
+            list_cursor_insert_before(&cursor, &doubled);
+            list_cursor_next(&cursor);
+        }
+    }
+    int expected[8] = {2, 1, 4, 2, 8, 4, 6, 3};
+    list_cursor_prev(&cursor);
+    for (int i = 7; i >= 0; i--) {
+        assert(*(int *) list_cursor_get(&cursor) == expected[i]);
+        if (i > 0) {
+            list_cursor_prev(&cursor);
+        }
+    }
+    assert(cursor.current == list_front(list_ptrs[0]));
+    cursor = list_cursor_back(list_ptrs[0]);
+    assert(*(int *) list_cursor_get(&cursor) == 3);
+    for (size_t i = 0; i < 8; i++) {
+        assert(*(int *) list_at(list_ptrs[0], i)->val == expected[i]);
+    }
+    list_clear(list_ptrs[0]);
+    printf("test_list_cursor passed!\n");
+}
+
+static void test_list_splice() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_init(list_ptrs[1], sizeof(int));
+    for (size_t i = 0; i < 6; i++) {
+        list_push_back(list_ptrs[0], &vals[i]);
+        list_push_back(list_ptrs[1], &vals[i]);
+    }
+    list_splice(list_ptrs[0], list_at(list_ptrs[0], 1), list_ptrs[1],
+                list_at(list_ptrs[1], 2), list_at(list_ptrs[1], 4));
+    int expected[9] = {6, 5, 2, 4, 1, 5, 2, 4, 3};
+    assert(list_size(list_ptrs[0]) == 9);
+    assert(list_size(list_ptrs[1]) == 3);
+    for (size_t i = 0; i < 9; i++) {
+        assert(*(int *) list_at(list_ptrs[0], i)->val == expected[i]);
+    }
+    list_splice(list_ptrs[0], NULL, list_ptrs[0], list_front(list_ptrs[0]), list_at(list_ptrs[0], 3));
+    int rotated[9] = {1, 5, 2, 4, 3, 6, 5, 2, 4};
+    for (size_t i = 0; i < 9; i++) {
+        assert(*(int *) list_at(list_ptrs[0], i)->val == rotated[i]);
+    }
+    assert(*(int *) list_back(list_ptrs[0])->val == 4);
+    list_clear(list_ptrs[1]);
+    for (size_t i = 0; i < 9; i++) {
+        assert(*(int *) list_at(list_ptrs[0], i)->val == rotated[i]);
+    }
+    list_clear(list_ptrs[0]);
+    printf("test_list_splice passed!\n");
+}
+
+static void test_list_concat_split() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_init(list_ptrs[1], sizeof(int));
+    for (int i = 0; i < 100; i++) {
+        list_push_back(i < 40 ? list_ptrs[0] : list_ptrs[1], &i);
+    }
+    list_concat(list_ptrs[0], list_ptrs[1]);
+    assert(list_size(list_ptrs[0]) == 100);
+    assert(list_is_empty(list_ptrs[1]) == true);
+    list_clear(list_ptrs[1]);
+    list_init(list_ptrs[1], sizeof(int));
+    list_split_at(list_ptrs[0], 70, list_ptrs[1]);
+    assert(list_size(list_ptrs[0]) == 70);
+    assert(list_size(list_ptrs[1]) == 30);
+    list_clear(list_ptrs[0]);
+    int expected = 70;
+    list_for_each(node, list_ptrs[1]) {
+        assert(*(int *) node->val == expected);
+        expected++;
+    }
+    assert(*(int *) list_back(list_ptrs[1])->val == 99);
+    list_split_at(list_ptrs[1], 30, list_ptrs[0]);
+    assert(list_size(list_ptrs[1]) == 30);
+    list_split_at(list_ptrs[1], 0, list_ptrs[0]);
+    assert(list_is_empty(list_ptrs[1]) == true);
+    assert(*(int *) list_front(list_ptrs[0])->val == 70);
+    list_clear(list_ptrs[0]);
+    list_clear(list_ptrs[1]);
+
+    list parts[64];
+    list_init(list_ptrs[0], sizeof(int));
+    for (int i = 0; i < 64; i++) {
+        list_init(&parts[i], sizeof(int));
+        list_push_back(&parts[i], &i);
+        list_concat(list_ptrs[0], &parts[i]);
+    }
+    assert(list_size(list_ptrs[0]) == 64);
+    assert(list_ptrs[0]->slabs_size == 0);
+    node* moved = list_front(list_ptrs[0]);
+    list_pop_front(list_ptrs[0]);
+    assert(parts[0].free_nodes == moved);
+    for (int i = 0; i < 64; i += 2) {
+        list_clear(&parts[i]);
+    }
+    int next = 1;
+    list_for_each(node, list_ptrs[0]) {
+        assert(*(int *) node->val == next);
+        next++;
+    }
+    list_clear(list_ptrs[0]);
+    for (int i = 1; i < 64; i += 2) {
+        assert(parts[i].slabs->live == 0);
+        list_clear(&parts[i]);
+    }
+    printf("test_list_concat_split passed!\n");
+}
+
+static void test_list_merge_sorted() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_init(list_ptrs[1], sizeof(int));
+    for (int i = 0; i < 300; i++) {
+        int val = (i % 3 == 0) ? i : 3 * i;
+        list_push_back(list_ptrs[0], &i);
+        list_push_back(list_ptrs[1], &val);
+    }
+    list_sort(list_ptrs[1], compare_ints);
+    node* first = list_front(list_ptrs[0]);
+    list_merge_sorted(list_ptrs[0], list_ptrs[1], compare_ints);
+    assert(list_size(list_ptrs[0]) == 600);
+    assert(list_is_empty(list_ptrs[1]) == true);
+    assert(list_front(list_ptrs[0]) == first);
+    int prev = -1;
+    list_for_each(node, list_ptrs[0]) {
+        assert(prev <= *(int *) node->val);
+        prev = *(int *) node->val;
+    }
+    assert(*(int *) list_back(list_ptrs[0])->val == 3 * 299);
+    assert(list_back(list_ptrs[0])->next == NULL);
+    list_clear(list_ptrs[1]);
+    list_clear(list_ptrs[0]);
+    printf("test_list_merge_sorted passed!\n");
+}
+
+static void test_list_from_array() {
+    list_init(list_ptrs[0], sizeof(int));
+    list_push_back(list_ptrs[0], &vals[0]);
+    list_from_array(list_ptrs[0], vals, 6);
+    assert(list_size(list_ptrs[0]) == 6);
+    assert(list_ptrs[0]->slabs_size == 1);
+    int array[1000];
+    for (int i = 0; i < 1000; i++) {
+        array[i] = i;
+    }
+    list_append_array(list_ptrs[0], array, 1000);
+    list_append_array(list_ptrs[0], array, 0);
+    assert(list_size(list_ptrs[0]) == 1006);
+    assert(list_ptrs[0]->slabs_size == 2);
+    for (size_t i = 0; i < 6; i++) {
+        assert(*(int *) list_at(list_ptrs[0], i)->val == vals[i]);
+    }
+    assert(*(int *) list_back(list_ptrs[0])->val == 999);
+    assert(list_back(list_ptrs[0])->prev == list_at(list_ptrs[0], 1004));
+    list_remove_at(list_ptrs[0], 500);
+    list_pop_front(list_ptrs[0]);
+    list_push_back(list_ptrs[0], &vals[0]);
+    assert(list_ptrs[0]->slabs_size == 2);
+    assert(*(int *) list_at(list_ptrs[0], 499)->val == 495);
+    size_t count = 0;
+    list_for_each(node, list_ptrs[0]) {
+        count++;
+    }
+    assert(count == 1005);
+    list_from_array(list_ptrs[0], vals, 0);
+    assert(list_is_empty(list_ptrs[0]) == true);
+    list_clear(list_ptrs[0]);
+    printf("test_list_from_array passed!\n");
+}
+
+static void test_list_defragment() {
+    list_init(list_ptrs[0], sizeof(int));
+    for (int i = 0; i < 1000; i++) {
+        int val = (i * 7919) % 1000;
+        list_push_back(list_ptrs[0], &val);
+    }
+    list_sort(list_ptrs[0], compare_ints);
+    for (int i = 0; i < 1000; i += 3) {
+        list_pop_front(list_ptrs[0]);
+    }
+    list_defragment(list_ptrs[0]);
+    assert(list_ptrs[0]->slabs_size == 1);
+    assert(list_ptrs[0]->free_nodes == NULL);
+    assert(list_ptrs[0]->churn == 0);
+    int expected = 334;
+    byte* prev = NULL;
+    list_for_each(node, list_ptrs[0]) {
+        assert(*(int *) node->val == expected);
+        assert(prev == NULL || (byte *) node > prev);
+        prev = (byte *) node;
+        expected++;
+    }
+    assert(expected == 1000);
+    assert(list_back(list_ptrs[0])->next == NULL);
+
+    list_set_defragment_threshold(list_ptrs[0], 100);
+    for (int i = 0; i < 99; i++) {
+        list_pop_front(list_ptrs[0]);
+    }
+    assert(list_maybe_defragment(list_ptrs[0]) == false);
+    node* front = list_front(list_ptrs[0]);
+    list_pop_back(list_ptrs[0]);
+    list_insert_after(list_ptrs[0], list_back(list_ptrs[0]), &vals[0]);
+    list_push_back(list_ptrs[0], &vals[0]);
+    assert(list_ptrs[0]->churn == 100);
+    assert(list_front(list_ptrs[0]) == front);
+    assert(*(int *) front->val == 433);
+    assert(list_maybe_defragment(list_ptrs[0]) == true);
+    assert(list_ptrs[0]->churn == 0);
+    assert(list_maybe_defragment(list_ptrs[0]) == false);
+    assert(*(int *) list_front(list_ptrs[0])->val == 433);
+    assert(*(int *) list_back(list_ptrs[0])->val == vals[0]);
+    list_clear(list_ptrs[0]);
+    assert(list_ptrs[0]->defragment_threshold == 100);
+    list_defragment(list_ptrs[0]);
+    assert(list_is_empty(list_ptrs[0]) == true);
+    list_clear(list_ptrs[0]);
+    printf("test_list_defragment passed!\n");
+}
+
 TestFunction test_functions[] = {
         test_list_init,
         test_list_back,
@@ -302,7 +665,18 @@ TestFunction test_functions[] = {
         test_list_merge,
         test_list_reverse,
         test_list_copy_to_array,
-        test_list_sort
+        test_list_sort,
+        test_list_reserve,
+        test_list_node_reuse,
+        test_list_free_slabs,
+        test_list_insert_before_after,
+        test_list_erase,
+        test_list_cursor,
+        test_list_splice,
+        test_list_concat_split,
+        test_list_merge_sorted,
+        test_list_from_array,
+        test_list_defragment
 };
 
 int main(int argc, char** argv) {
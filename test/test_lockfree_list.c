@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/lockfree_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+lockfree_list* list_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+
+/* A call made by a worker thread which stops when it compares a node holding pause_at */
+struct paused_call {
+    lockfree_list_handle* handle;
+    int val;
+    int pause_at;
+    bool remove;
+    bool result;
+    atomic_bool paused;
+    atomic_bool resumed;
+};
+
+_Thread_local struct paused_call* current_call = NULL;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static int pausing_comparator(const void* lhs, const void* rhs) {
+    struct paused_call* call = current_call;
+    if (call != NULL && *(const int *) lhs == call->pause_at) {
+        current_call = NULL;
+        atomic_store(&call->paused, true);
+        while (!atomic_load(&call->resumed)) {
+            sched_yield();
+        }
+    }
+    return int_comparator(lhs, rhs);
+}
+
+static void* paused_call_worker(void* arg) {
+    struct paused_call* call = (struct paused_call *) arg;
+    call->handle = lockfree_list_attach(list_ptr);
+    current_call = call;
+    if (call->remove) {
+        call->result = lockfree_list_remove(list_ptr, call->handle, &call->val);
+    }
+    else {
+        call->result = lockfree_list_contains(list_ptr, call->handle, &call->val);
+    }
+    return NULL;
+}
+
+static void start_paused_call(pthread_t* thread, struct paused_call* call) {
+    atomic_init(&call->paused, false);
+    atomic_init(&call->resumed, false);
+    pthread_create(thread, NULL, paused_call_worker, call);
+    while (!atomic_load(&call->paused)) {
+        sched_yield();
+    }
+}
+
+static void retire_batch(lockfree_list_handle* handle, int first) {
+    for (int i = first; i < first + LOCKFREE_LIST_RETIRE_THRESHOLD; i++) {
+        lockfree_list_insert(list_ptr, handle, &i);
+    }
+    for (int i = first; i < first + LOCKFREE_LIST_RETIRE_THRESHOLD; i++) {
+        lockfree_list_remove(list_ptr, handle, &i);
+    }
+}
+
+static bool is_retired(const lockfree_list_handle* handle, int val) {
+    for (size_t bin = 0; bin < 3; bin++) {
+        for (lockfree_node* node = handle->retired[bin]; node != NULL; node = node->retired_next) {
+            if (*(int *) node->val == val) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void* insert_remove_worker(void* arg) {
+    int id = *(int *) arg;
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (int round = 0; round < 20; round++) {
+        for (int i = id; i < 2000; i += 4) {
+            assert(lockfree_list_insert(list_ptr, handle, &i) == true);
+        }
+        for (int i = id; i < 2000; i += 4) {
+            assert(lockfree_list_contains(list_ptr, handle, &i) == true);
+            if (i % 8 != id || round == 19) {
+                assert(lockfree_list_remove(list_ptr, handle, &i) == true);
+                assert(lockfree_list_contains(list_ptr, handle, &i) == false);
+            }
+        }
+        for (int i = id; i < 2000; i += 8) {
+            if (round < 19) {
+                assert(lockfree_list_remove(list_ptr, handle, &i) == true);
+            }
+        }
+    }
+    lockfree_list_detach(list_ptr, handle);
+    return NULL;
+}
+
+static void* contended_worker(void* arg) {
+    int* removed = (int *) arg;
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (int i = 0; i < 5000; i++) {
+        if (lockfree_list_remove(list_ptr, handle, &i)) {
+            (*removed)++;
+        }
+    }
+    lockfree_list_detach(list_ptr, handle);
+    return NULL;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_lockfree_list_init() {
+    lockfree_list_init(list_ptr, sizeof(int), int_comparator);
+    assert(lockfree_list_is_empty(list_ptr) == true);
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    assert(lockfree_list_contains(list_ptr, handle, &vals[0]) == false);
+    lockfree_list_detach(list_ptr, handle);
+    assert(lockfree_list_attach(list_ptr) == handle);
+    lockfree_list_destroy(list_ptr);
+    printf("test_lockfree_list_init passed!\n");
+}
+
+static void test_lockfree_list_insert() {
+    lockfree_list_init(list_ptr, sizeof(int), int_comparator);
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (size_t i = 0; i < 6; i++) {
+        assert(lockfree_list_insert(list_ptr, handle, &vals[i]) == true);
+    }
+    assert(lockfree_list_insert(list_ptr, handle, &vals[2]) == false);
+    assert(lockfree_list_size(list_ptr) == 6);
+    int array[6];
+    lockfree_list_copy_to_array(list_ptr, array);
+    for (int i = 0; i < 6; i++) {
+        assert(array[i] == i + 1);
+        assert(lockfree_list_contains(list_ptr, handle, &array[i]) == true);
+    }
+    int missing = 7;
+    assert(lockfree_list_contains(list_ptr, handle, &missing) == false);
+    lockfree_list_destroy(list_ptr);
+    printf("test_lockfree_list_insert passed!\n");
+}
+
+static void test_lockfree_list_remove() {
+    lockfree_list_init(list_ptr, sizeof(int), int_comparator);
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (int i = 0; i < 1000; i++) {
+        lockfree_list_insert(list_ptr, handle, &i);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        assert(lockfree_list_remove(list_ptr, handle, &i) == true);
+        assert(lockfree_list_remove(list_ptr, handle, &i) == false);
+    }
+    assert(lockfree_list_size(list_ptr) == 500);
+    for (int i = 0; i < 1000; i++) {
+        assert(lockfree_list_contains(list_ptr, handle, &i) == (i % 2 == 1));
+    }
+    lockfree_list_detach(list_ptr, handle);
+    lockfree_list_destroy(list_ptr);
+    printf("test_lockfree_list_remove passed!\n");
+}
+
+static void test_lockfree_list_concurrent() {
+    lockfree_list_init(list_ptr, sizeof(int), int_comparator);
+    pthread_t threads[4];
+    int ids[4] = {0, 1, 2, 3};
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, insert_remove_worker, &ids[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    assert(lockfree_list_is_empty(list_ptr) == true);
+
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (int i = 0; i < 5000; i++) {
+        lockfree_list_insert(list_ptr, handle, &i);
+    }
+    lockfree_list_detach(list_ptr, handle);
+    int removed[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, contended_worker, &removed[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    assert(removed[0] + removed[1] + removed[2] + removed[3] == 5000);
+    assert(lockfree_list_is_empty(list_ptr) == true);
+    lockfree_list_destroy(list_ptr);
+    printf("test_lockfree_list_concurrent passed!\n");
+}
+
+static void test_lockfree_list_reclaim_behind_epoch() {
+    lockfree_list_init(list_ptr, sizeof(int), pausing_comparator);
+    lockfree_list_handle* handle = lockfree_list_attach(list_ptr);
+    for (int i = 0; i < 1000; i++) {
+        lockfree_list_insert(list_ptr, handle, &i);
+    }
+    pthread_t remover_thread;
+    pthread_t reader_thread;
+    struct paused_call remover = {.val = 500, .pause_at = 0, .remove = true};
+    struct paused_call reader = {.val = 500, .pause_at = 500, .remove = false};
+
+    /* The remover enters in epoch e and stops, the epoch moves to e + 1 meanwhile */
+    start_paused_call(&remover_thread, &remover);
+    size_t epoch = atomic_load(&list_ptr->epoch);
+    retire_batch(handle, 10000);
+    assert(atomic_load(&list_ptr->epoch) == epoch + 1);
+
+    /* A reader entering in e + 1 stands on 500, then the remover unlinks it */
+    start_paused_call(&reader_thread, &reader);
+    atomic_store(&remover.resumed, true);
+    pthread_join(remover_thread, NULL);
+    assert(remover.result == true);
+
+    /* The reader holds the epoch at e + 2, the remover must keep 500 when entering it */
+    retire_batch(handle, 20000);
+    assert(atomic_load(&list_ptr->epoch) == epoch + 2);
+    assert(lockfree_list_contains(list_ptr, remover.handle, &vals[0]) == true);
+    assert(is_retired(remover.handle, 500) == true);
+    atomic_store(&reader.resumed, true);
+    pthread_join(reader_thread, NULL);
+    assert(reader.result == false);
+    lockfree_list_destroy(list_ptr);
+    printf("test_lockfree_list_reclaim_behind_epoch passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_lockfree_list_init,
+        test_lockfree_list_insert,
+        test_lockfree_list_remove,
+        test_lockfree_list_concurrent,
+        test_lockfree_list_reclaim_behind_epoch
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    list_ptr = (lockfree_list *) malloc(sizeof(lockfree_list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
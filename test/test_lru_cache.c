@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/lru_cache.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+lru_cache* cache_ptr;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void put(int key) {
+    double value = key * 0.5;
+    lru_cache_put(cache_ptr, &key, &value);
+}
+
+static bool get(int key) {
+    double* value = (double *) lru_cache_get(cache_ptr, &key);
+    assert(value == NULL || *value == key * 0.5);
+    return value != NULL;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_lru_cache_init() {
+    lru_cache_init(cache_ptr, sizeof(int), sizeof(double), 4);
+    assert(lru_cache_is_empty(cache_ptr) == true);
+    assert(lru_cache_capacity(cache_ptr) == 4);
+    assert(cache_ptr->value_offset == 8);
+    assert(list_capacity(&cache_ptr->entries) == 4);
+    lru_cache_clear(cache_ptr);
+    printf("test_lru_cache_init passed!\n");
+}
+
+static void test_lru_cache_put_get() {
+    lru_cache_init(cache_ptr, sizeof(int), sizeof(double), 3);
+    put(1);
+    put(2);
+    put(3);
+    assert(get(1) == true);
+    put(4);
+    assert(lru_cache_contains(cache_ptr, &(int) {2}) == false);
+    assert(get(3) == true);
+    put(5);
+    assert(get(1) == false);
+    int expected[3] = {5, 3, 4};
+    size_t offset = 0;
+    lru_cache_for_each(entry, cache_ptr) {
+        assert(*(int *) lru_cache_key(cache_ptr, entry) == expected[offset]);
+        offset++;
+    }
+    assert(offset == 3);
+    put(3);
+    assert(*(int *) lru_cache_key(cache_ptr, cache_ptr->entries.head) == 3);
+    assert(lru_cache_size(cache_ptr) == 3);
+    assert(lru_cache_hits(cache_ptr) == 2);
+    assert(lru_cache_misses(cache_ptr) == 1);
+    lru_cache_clear(cache_ptr);
+    printf("test_lru_cache_put_get passed!\n");
+}
+
+static void test_lru_cache_remove() {
+    lru_cache_init(cache_ptr, sizeof(int), sizeof(double), 8);
+    for (int key = 0; key < 8; key++) {
+        put(key);
+    }
+    assert(lru_cache_remove(cache_ptr, &(int) {3}) == true);
+    assert(lru_cache_remove(cache_ptr, &(int) {3}) == false);
+    assert(lru_cache_size(cache_ptr) == 7);
+    assert(*(double *) lru_cache_peek(cache_ptr, &(int) {0}) == 0.0);
+    put(8);
+    put(9);
+    assert(lru_cache_contains(cache_ptr, &(int) {0}) == false);
+    assert(lru_cache_contains(cache_ptr, &(int) {1}) == true);
+    assert(lru_cache_hits(cache_ptr) == 0);
+    lru_cache_clear(cache_ptr);
+    printf("test_lru_cache_remove passed!\n");
+}
+
+static void test_lru_cache_churn() {
+    lru_cache_init(cache_ptr, sizeof(int), sizeof(double), 100);
+    size_t slabs_size = cache_ptr->entries.slabs_size;
+    for (int i = 0; i < 100000; i++) {
+        int key = (i * 7919) % 250;
+        if (!get(key)) {
+            put(key);
+        }
+        if (i % 7 == 0) {
+            lru_cache_remove(cache_ptr, &(int) {(i * 31) % 250});
+        }
+    }
+    assert(cache_ptr->entries.slabs_size == slabs_size);
+    assert(lru_cache_hits(cache_ptr) + lru_cache_misses(cache_ptr) == 100000);
+    size_t size = 0;
+    lru_cache_for_each(entry, cache_ptr) {
+        assert(lru_cache_peek(cache_ptr, lru_cache_key(cache_ptr, entry)) == lru_cache_value(cache_ptr, entry));
+        size++;
+    }
+    assert(size == lru_cache_size(cache_ptr));
+    for (int key = 0; key < 250; key++) {
+        double* value = (double *) lru_cache_peek(cache_ptr, &key);
+        assert(value == NULL || *value == key * 0.5);
+    }
+    lru_cache_clear(cache_ptr);
+    printf("test_lru_cache_churn passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_lru_cache_init,
+        test_lru_cache_put_get,
+        test_lru_cache_remove,
+        test_lru_cache_churn
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    cache_ptr = (lru_cache *) malloc(sizeof(lru_cache));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(cache_ptr);
+    cache_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/persistent_vector.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+persistent_vector* versions[3];
+int vals[6] = {6, 1, 5, 2, 4, 3};
+int rets[6];
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_persistent_vector_init() {
+    persistent_vector_init(versions[0], sizeof(int));
+    assert(versions[0]->root == NULL);
+    assert(versions[0]->tail == NULL);
+    assert(versions[0]->size == 0);
+    assert(versions[0]->shift == PERSISTENT_VECTOR_BITS);
+    assert(versions[0]->element_size == sizeof(int));
+    persistent_vector_destroy(versions[0]);
+    printf("test_persistent_vector_init passed!\n");
+}
+
+static void test_persistent_vector_push_back() {
+    persistent_vector_init(versions[0], sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        persistent_vector_push_back(versions[0], &vals[i], versions[1]);
+        persistent_vector_destroy(versions[0]);
+        *versions[0] = *versions[1];
+    }
+    assert(persistent_vector_size(versions[0]) == 6);
+    persistent_vector_for_each(index, versions[0]) {
+        persistent_vector_at(versions[0], index, &rets[0]);
+        assert(rets[0] == vals[index]);
+    }
+    persistent_vector_destroy(versions[0]);
+    printf("test_persistent_vector_push_back passed!\n");
+}
+
+static void test_persistent_vector_large() {
+    const int count = 40000;
+    persistent_vector_init(versions[0], sizeof(int));
+    for(int i = 0; i < count; i++) {
+        persistent_vector_push_back(versions[0], &i, versions[1]);
+        persistent_vector_destroy(versions[0]);
+        *versions[0] = *versions[1];
+    }
+    assert(persistent_vector_size(versions[0]) == count);
+    assert(versions[0]->shift > PERSISTENT_VECTOR_BITS);
+    int* array = (int *) malloc(sizeof(int) * count);
+    persistent_vector_copy_to_array(versions[0], array);
+    for(int i = 0; i < count; i++) {
+        assert(array[i] == i);
+    }
+    for(int i = count; i > 0; i--) {
+        persistent_vector_at(versions[0], i - 1, &rets[0]);
+        assert(rets[0] == i - 1);
+        persistent_vector_pop_back(versions[0], versions[1]);
+        persistent_vector_destroy(versions[0]);
+        *versions[0] = *versions[1];
+    }
+    assert(persistent_vector_is_empty(versions[0]) == true);
+    assert(versions[0]->root == NULL);
+    persistent_vector_destroy(versions[0]);
+    free(array);
+    array = NULL;
+    printf("test_persistent_vector_large passed!\n");
+}
+
+static void test_persistent_vector_set() {
+    const int count = 2000;
+    persistent_vector_init(versions[0], sizeof(int));
+    for(int i = 0; i < count; i++) {
+        persistent_vector_push_back(versions[0], &i, versions[1]);
+        persistent_vector_destroy(versions[0]);
+        *versions[0] = *versions[1];
+    }
+    persistent_vector_set(versions[0], 5, &vals[0], versions[1]);
+    persistent_vector_set(versions[1], count - 1, &vals[1], versions[2]);
+    persistent_vector_at(versions[0], 5, &rets[0]);
+    persistent_vector_at(versions[1], 5, &rets[1]);
+    persistent_vector_at(versions[2], count - 1, &rets[2]);
+    persistent_vector_at(versions[1], count - 1, &rets[3]);
+    assert(rets[0] == 5);
+    assert(rets[1] == vals[0]);
+    assert(rets[2] == vals[1]);
+    assert(rets[3] == count - 1);
+    assert(versions[0]->tail == versions[1]->tail);
+    for(size_t i = 0; i < 3; i++) {
+        persistent_vector_destroy(versions[i]);
+    }
+    printf("test_persistent_vector_set passed!\n");
+}
+
+static void test_persistent_vector_copy() {
+    persistent_vector_init(versions[0], sizeof(int));
+    for(size_t i = 0; i < 3; i++) {
+        persistent_vector_push_back(versions[0], &vals[i], versions[1]);
+        persistent_vector_destroy(versions[0]);
+        *versions[0] = *versions[1];
+    }
+    persistent_vector_copy(versions[0], versions[1]);
+    persistent_vector_push_back(versions[0], &vals[3], versions[2]);
+    persistent_vector_destroy(versions[0]);
+    assert(persistent_vector_size(versions[1]) == 3);
+    assert(persistent_vector_size(versions[2]) == 4);
+    persistent_vector_copy_to_array(versions[1], rets);
+    for(size_t i = 0; i < 3; i++) {
+        assert(rets[i] == vals[i]);
+    }
+    persistent_vector_at(versions[2], 3, &rets[0]);
+    assert(rets[0] == vals[3]);
+    persistent_vector_destroy(versions[1]);
+    persistent_vector_destroy(versions[2]);
+    printf("test_persistent_vector_copy passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_persistent_vector_init,
+        test_persistent_vector_push_back,
+        test_persistent_vector_large,
+        test_persistent_vector_set,
+        test_persistent_vector_copy
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    size_t versions_size = sizeof(versions) / sizeof(versions[0]);
+    for(size_t i = 0; i < versions_size; i++) {
+        versions[i] = (persistent_vector *) malloc(sizeof(persistent_vector));
+    }
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    for(size_t i = 0; i < versions_size; i++) {
+        free(versions[i]);
+        versions[i] = NULL;
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "../src/rcu_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+rcu_list* list_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+atomic_bool writer_done;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void assert_equals(const int* expected, size_t size) {
+    assert(rcu_list_size(list_ptr) == size);
+    size_t offset = 0;
+    rcu_list_for_each(node, list_ptr) {
+        assert(*(int *) node->val == expected[offset]);
+        offset++;
+    }
+    assert(offset == size);
+}
+
+static void* reader_worker(void* arg) {
+    size_t* reads = (size_t *) arg;
+    rcu_list_reader* reader = rcu_list_register(list_ptr);
+    while (!atomic_load(&writer_done)) {
+        rcu_list_read_lock(list_ptr, reader);
+        int prev = -1;
+        rcu_list_for_each(node, list_ptr) {
+            int val = *(int *) node->val;
+            assert(val > prev);
+            prev = val;
+        }
+        rcu_list_read_unlock(reader);
+        (*reads)++;
+    }
+    rcu_list_unregister(list_ptr, reader);
+    return NULL;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_rcu_list_init() {
+    rcu_list_init(list_ptr, sizeof(int));
+    assert(rcu_list_is_empty(list_ptr) == true);
+    assert(rcu_list_front(list_ptr) == NULL);
+    assert(rcu_list_retired_size(list_ptr) == 0);
+    rcu_list_destroy(list_ptr);
+    printf("test_rcu_list_init passed!\n");
+}
+
+static void test_rcu_list_insert() {
+    rcu_list_init(list_ptr, sizeof(int));
+    rcu_list_push_back(list_ptr, &vals[0]);
+    rcu_list_push_back(list_ptr, &vals[1]);
+    rcu_list_push_front(list_ptr, &vals[2]);
+    rcu_list_insert_at(list_ptr, &vals[3], 1);
+    rcu_list_insert_at(list_ptr, &vals[4], 4);
+    int expected[5] = {5, 2, 6, 1, 4};
+    assert_equals(expected, 5);
+    assert(*(int *) rcu_list_front(list_ptr) == 5);
+    assert(rcu_list_index_of(list_ptr, &vals[4]) == 4);
+    assert(rcu_list_contains(list_ptr, &vals[5]) == false);
+    rcu_list_push_back(list_ptr, &vals[5]);
+    assert(rcu_list_index_of(list_ptr, &vals[5]) == 5);
+    rcu_list_destroy(list_ptr);
+    printf("test_rcu_list_insert passed!\n");
+}
+
+static void test_rcu_list_remove() {
+    rcu_list_init(list_ptr, sizeof(int));
+    for (size_t i = 0; i < 6; i++) {
+        rcu_list_push_back(list_ptr, &vals[i]);
+        rcu_list_push_back(list_ptr, &vals[i]);
+    }
+    rcu_list_remove(list_ptr, &vals[1]);
+    rcu_list_pop_front(list_ptr);
+    rcu_list_remove_at(list_ptr, 8);
+    int expected[8] = {6, 5, 5, 2, 2, 4, 4, 3};
+    assert_equals(expected, 8);
+    rcu_list_push_back(list_ptr, &vals[1]);
+    assert(rcu_list_index_of(list_ptr, &vals[1]) == 8);
+    assert(rcu_list_retired_size(list_ptr) == 4);
+    rcu_list_reader* reader = rcu_list_register(list_ptr);
+    rcu_list_synchronize(list_ptr);
+    assert(rcu_list_retired_size(list_ptr) == 0);
+    rcu_list_unregister(list_ptr, reader);
+    rcu_list_destroy(list_ptr);
+    printf("test_rcu_list_remove passed!\n");
+}
+
+static void test_rcu_list_readers() {
+    rcu_list_init(list_ptr, sizeof(int));
+    for (int i = 0; i < 100; i++) {
+        rcu_list_push_back(list_ptr, &i);
+    }
+    atomic_store(&writer_done, false);
+    pthread_t threads[4];
+    size_t reads[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, reader_worker, &reads[i]);
+    }
+    for (int round = 0; round < 20000; round++) {
+        int val = 100 + round;
+        rcu_list_push_back(list_ptr, &val);
+        rcu_list_pop_front(list_ptr);
+        if (round % 97 == 0) {
+            rcu_list_remove_at(list_ptr, 50);
+            val = -1;
+            rcu_list_push_front(list_ptr, &val);
+            rcu_list_pop_front(list_ptr);
+            rcu_list_insert_at(list_ptr, &(int) {*(int *) rcu_list_front(list_ptr) - 1}, 0);
+        }
+        if (round % 1000 == 0) {
+            sched_yield();
+        }
+    }
+    atomic_store(&writer_done, true);
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    assert(rcu_list_size(list_ptr) == 100);
+    assert(rcu_list_retired_size(list_ptr) < RCU_LIST_RECLAIM_THRESHOLD + 20000);
+    rcu_list_synchronize(list_ptr);
+    assert(rcu_list_retired_size(list_ptr) == 0);
+    rcu_list_destroy(list_ptr);
+    printf("test_rcu_list_readers passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_rcu_list_init,
+        test_rcu_list_insert,
+        test_rcu_list_remove,
+        test_rcu_list_readers
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    list_ptr = (rcu_list *) malloc(sizeof(rcu_list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
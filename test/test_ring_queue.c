@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/ring_queue.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+ring_queue* queue_ptr;
+double vals[6] = {1.1, 1.2, 1.3, 1.4, 1.5, 1.6};
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_ring_queue_init() {
+    ring_queue_init(queue_ptr, sizeof(double));
+    assert(queue_ptr->data != NULL);
+    assert(queue_ptr->size == 0);
+    assert(queue_ptr->capacity == RING_QUEUE_INIT_CAPACITY);
+    assert(ring_queue_front_ptr(queue_ptr) == NULL);
+    ring_queue_destroy(queue_ptr);
+    printf("test_ring_queue_init passed!\n");
+}
+
+static void test_ring_queue_push_pop() {
+    ring_queue_init(queue_ptr, sizeof(double));
+    for (size_t i = 0; i < 6; i++) {
+        ring_queue_push(queue_ptr, &vals[i]);
+    }
+    double val;
+    ring_queue_front(queue_ptr, &val);
+    assert(val == vals[0]);
+    ring_queue_back(queue_ptr, &val);
+    assert(val == vals[5]);
+    ring_queue_for_each(index, queue_ptr) {
+        assert(*(double *) ring_queue_at(queue_ptr, index) == vals[index]);
+    }
+    for (size_t i = 0; i < 6; i++) {
+        assert(*(double *) ring_queue_front_ptr(queue_ptr) == vals[i]);
+        ring_queue_pop(queue_ptr);
+    }
+    assert(ring_queue_is_empty(queue_ptr) == true);
+    ring_queue_destroy(queue_ptr);
+    printf("test_ring_queue_push_pop passed!\n");
+}
+
+static void test_ring_queue_wrap() {
+    ring_queue_init(queue_ptr, sizeof(int));
+    byte* data = queue_ptr->data;
+    for (int i = 0; i < 10; i++) {
+        ring_queue_push(queue_ptr, &i);
+    }
+    for (int i = 10; i < 10000; i++) {
+        assert(*(int *) ring_queue_front_ptr(queue_ptr) == i - 10);
+        ring_queue_pop(queue_ptr);
+        ring_queue_push(queue_ptr, &i);
+    }
+    assert(queue_ptr->data == data);
+    assert(ring_queue_capacity(queue_ptr) == RING_QUEUE_INIT_CAPACITY);
+    ring_queue_destroy(queue_ptr);
+    printf("test_ring_queue_wrap passed!\n");
+}
+
+static void test_ring_queue_grow() {
+    ring_queue_init(queue_ptr, sizeof(int));
+    for (int i = 0; i < 12; i++) {
+        ring_queue_push(queue_ptr, &i);
+    }
+    for (int i = 0; i < 12; i++) {
+        ring_queue_pop(queue_ptr);
+    }
+    for (int i = 0; i < 1000; i++) {
+        ring_queue_push(queue_ptr, &i);
+    }
+    assert(ring_queue_size(queue_ptr) == 1000);
+    assert(ring_queue_capacity(queue_ptr) == 1024);
+    ring_queue_for_each(index, queue_ptr) {
+        assert(*(int *) ring_queue_at(queue_ptr, index) == (int) index);
+    }
+    ring_queue_reserve(queue_ptr, 3000);
+    assert(ring_queue_capacity(queue_ptr) == 4096);
+    int val;
+    ring_queue_back(queue_ptr, &val);
+    assert(val == 999);
+    ring_queue_clear(queue_ptr);
+    assert(ring_queue_is_empty(queue_ptr) == true);
+    assert(ring_queue_capacity(queue_ptr) == 4096);
+    ring_queue_destroy(queue_ptr);
+    printf("test_ring_queue_grow passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_ring_queue_init,
+        test_ring_queue_push_pop,
+        test_ring_queue_wrap,
+        test_ring_queue_grow
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    queue_ptr = (ring_queue *) malloc(sizeof(ring_queue));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(queue_ptr);
+    queue_ptr = NULL;
+    return 0;
+}
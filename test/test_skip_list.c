@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/skip_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+skip_list* list_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static void assert_equals(const int* expected, size_t size) {
+    assert(skip_list_size(list_ptr) == size);
+    size_t offset = 0;
+    skip_list_for_each(node, list_ptr) {
+        assert(*(int *) node->val == expected[offset]);
+        offset++;
+    }
+    assert(offset == size);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_skip_list_init() {
+    skip_list_init(list_ptr, sizeof(int), NULL);
+    assert(skip_list_is_empty(list_ptr) == true);
+    assert(skip_list_front(list_ptr) == NULL);
+    assert(skip_list_back(list_ptr) == NULL);
+    skip_list_clear(list_ptr);
+    printf("test_skip_list_init passed!\n");
+}
+
+static void test_skip_list_push() {
+    skip_list_init(list_ptr, sizeof(int), NULL);
+    for(size_t i = 0; i < 6; i++) {
+        skip_list_push_back(list_ptr, &vals[i]);
+    }
+    skip_list_push_front(list_ptr, &vals[5]);
+    int expected[7] = {3, 6, 1, 5, 2, 4, 3};
+    assert_equals(expected, 7);
+    assert(*(int *) skip_list_back(list_ptr)->val == 3);
+    assert(skip_list_index_of(list_ptr, &vals[3]) == 4);
+    skip_list_clear(list_ptr);
+    printf("test_skip_list_push passed!\n");
+}
+
+static void test_skip_list_insert_at() {
+    skip_list_init(list_ptr, sizeof(int), NULL);
+    int expected[3000];
+    size_t size = 0;
+    for(int i = 0; i < 3000; i++) {
+        size_t index = ((size_t) i * 7919) % (size + 1);
+        memmove(expected + index + 1, expected + index, sizeof(int) * (size - index));
+        expected[index] = i;
+        size++;
+        skip_list_insert_at(list_ptr, &i, index);
+    }
+    assert_equals(expected, size);
+    for(size_t i = 0; i < size; i++) {
+        assert(*(int *) skip_list_at(list_ptr, i)->val == expected[i]);
+    }
+    skip_list_clear(list_ptr);
+    printf("test_skip_list_insert_at passed!\n");
+}
+
+static void test_skip_list_remove_at() {
+    skip_list_init(list_ptr, sizeof(int), NULL);
+    int expected[3000];
+    size_t size = 3000;
+    for(int i = 0; i < 3000; i++) {
+        expected[i] = i;
+        skip_list_push_back(list_ptr, &i);
+    }
+    while(size > 0) {
+        size_t index = (3000 - size) * 7919 % size;
+        memmove(expected + index, expected + index + 1, sizeof(int) * (size - index - 1));
+        size--;
+        skip_list_remove_at(list_ptr, index);
+        if (size % 101 == 0) {
+            for(size_t i = 0; i < size; i++) {
+                assert(*(int *) skip_list_at(list_ptr, i)->val == expected[i]);
+            }
+        }
+    }
+    assert(skip_list_is_empty(list_ptr) == true);
+    assert(list_ptr->level == 1);
+    skip_list_push_back(list_ptr, &vals[0]);
+    skip_list_push_back(list_ptr, &vals[1]);
+    skip_list_pop_front(list_ptr);
+    skip_list_pop_back(list_ptr);
+    assert(skip_list_is_empty(list_ptr) == true);
+    skip_list_clear(list_ptr);
+    printf("test_skip_list_remove_at passed!\n");
+}
+
+static void test_skip_list_sorted() {
+    skip_list_init(list_ptr, sizeof(int), int_comparator);
+    for(int i = 0; i < 2000; i++) {
+        int val = (i * 7919) % 1000;
+        skip_list_insert(list_ptr, &val);
+    }
+    assert(skip_list_size(list_ptr) == 2000);
+    for(int val = 0; val < 1000; val++) {
+        assert(skip_list_rank(list_ptr, &val) == (size_t) (2 * val));
+        assert(skip_list_index_of(list_ptr, &val) == 2 * val);
+        assert(*(int *) skip_list_at(list_ptr, 2 * val + 1)->val == val);
+    }
+    int missing = 1000;
+    assert(skip_list_index_of(list_ptr, &missing) == -1);
+    assert(skip_list_rank(list_ptr, &missing) == 2000);
+    for(int val = 0; val < 1000; val += 2) {
+        assert(skip_list_remove(list_ptr, &val) == true);
+        assert(skip_list_remove(list_ptr, &val) == true);
+        assert(skip_list_remove(list_ptr, &val) == false);
+    }
+    int* array = (int *) malloc(sizeof(int) * skip_list_size(list_ptr));
+    skip_list_copy_to_array(list_ptr, array);
+    for(size_t i = 0; i < skip_list_size(list_ptr); i++) {
+        assert(array[i] == (int) (i / 2) * 2 + 1);
+    }
+    free(array);
+    array = NULL;
+    skip_list_clear(list_ptr);
+    printf("test_skip_list_sorted passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_skip_list_init,
+        test_skip_list_push,
+        test_skip_list_insert_at,
+        test_skip_list_remove_at,
+        test_skip_list_sorted
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    list_ptr = (skip_list *) malloc(sizeof(skip_list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
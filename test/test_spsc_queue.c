@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/spsc_queue.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+spsc_queue* queue_ptr;
+int transfer_size = 1000000;
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void* producer(void* arg) {
+    int batch[37];
+    int next = 0;
+    while (next < transfer_size) {
+        size_t count = 0;
+        while (count < 37 && next + (int) count < transfer_size) {
+            batch[count] = next + (int) count;
+            count++;
+        }
+        size_t pushed = next % 3 == 0 ? spsc_queue_push(queue_ptr, &batch[0]) : spsc_queue_push_n(queue_ptr, batch, count);
+        if (pushed == 0) {
+            sched_yield();
+        }
+        next += (int) pushed;
+    }
+    return NULL;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_spsc_queue_init() {
+    spsc_queue_init(queue_ptr, sizeof(int), 5);
+    assert(spsc_queue_is_empty(queue_ptr) == true);
+    assert(spsc_queue_size(queue_ptr) == 0);
+    assert(spsc_queue_capacity(queue_ptr) == 8);
+    assert((size_t) ((byte *) &queue_ptr->head - (byte *) &queue_ptr->tail) >= SPSC_QUEUE_CACHE_LINE);
+    spsc_queue_destroy(queue_ptr);
+    printf("test_spsc_queue_init passed!\n");
+}
+
+static void test_spsc_queue_push_pop() {
+    spsc_queue_init(queue_ptr, sizeof(int), 4);
+    int val;
+    assert(spsc_queue_pop(queue_ptr, &val) == false);
+    for (int i = 0; i < 4; i++) {
+        assert(spsc_queue_push(queue_ptr, &i) == true);
+    }
+    assert(spsc_queue_push(queue_ptr, &(int) {4}) == false);
+    assert(spsc_queue_size(queue_ptr) == 4);
+    for (int i = 0; i < 10; i++) {
+        assert(spsc_queue_pop(queue_ptr, &val) == true);
+        assert(val == i);
+        int next = i + 4;
+        assert(spsc_queue_push(queue_ptr, &next) == true);
+    }
+    for (int i = 10; i < 14; i++) {
+        assert(spsc_queue_pop(queue_ptr, &val) == true);
+        assert(val == i);
+    }
+    assert(spsc_queue_is_empty(queue_ptr) == true);
+    spsc_queue_destroy(queue_ptr);
+    printf("test_spsc_queue_push_pop passed!\n");
+}
+
+static void test_spsc_queue_push_n_pop_n() {
+    spsc_queue_init(queue_ptr, sizeof(int), 8);
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int popped[10];
+    assert(spsc_queue_push_n(queue_ptr, values, 5) == 5);
+    assert(spsc_queue_pop_n(queue_ptr, popped, 3) == 3);
+    assert(popped[0] == 0 && popped[2] == 2);
+    assert(spsc_queue_push_n(queue_ptr, values, 10) == 6);
+    assert(spsc_queue_push_n(queue_ptr, values, 1) == 0);
+    assert(spsc_queue_pop_n(queue_ptr, popped, 10) == 8);
+    int expected[8] = {3, 4, 0, 1, 2, 3, 4, 5};
+    for (size_t i = 0; i < 8; i++) {
+        assert(popped[i] == expected[i]);
+    }
+    assert(spsc_queue_pop_n(queue_ptr, popped, 10) == 0);
+    assert(spsc_queue_push_n(queue_ptr, values, 0) == 0);
+    spsc_queue_destroy(queue_ptr);
+    printf("test_spsc_queue_push_n_pop_n passed!\n");
+}
+
+static void test_spsc_queue_threads() {
+    spsc_queue_init(queue_ptr, sizeof(int), 64);
+    pthread_t thread;
+    pthread_create(&thread, NULL, producer, NULL);
+    int batch[29];
+    int expected = 0;
+    while (expected < transfer_size) {
+        size_t count = spsc_queue_pop_n(queue_ptr, batch, expected % 2 == 0 ? 29 : 1);
+        if (count == 0) {
+            sched_yield();
+        }
+        for (size_t i = 0; i < count; i++) {
+            assert(batch[i] == expected);
+            expected++;
+        }
+    }
+    pthread_join(thread, NULL);
+    assert(spsc_queue_is_empty(queue_ptr) == true);
+    spsc_queue_destroy(queue_ptr);
+    printf("test_spsc_queue_threads passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_spsc_queue_init,
+        test_spsc_queue_push_pop,
+        test_spsc_queue_push_n_pop_n,
+        test_spsc_queue_threads
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    queue_ptr = (spsc_queue *) aligned_alloc(SPSC_QUEUE_CACHE_LINE, sizeof(spsc_queue));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(queue_ptr);
+    queue_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/topk.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+topk* topk_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+int rets[6];
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static int int_comparator(const void* lhs, const void* rhs) {
+    int left = *(const int *) lhs;
+    int right = *(const int *) rhs;
+    return (left > right) - (left < right);
+}
+
+static int int_reverse_comparator(const void* lhs, const void* rhs) {
+    return int_comparator(rhs, lhs);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_topk_init() {
+    topk_init(topk_ptr, 3, sizeof(int), int_comparator);
+    assert(topk_size(topk_ptr) == 0);
+    assert(topk_ptr->k == 3);
+    assert(topk_is_full(topk_ptr) == false);
+    topk_destroy(topk_ptr);
+    printf("test_topk_init passed!\n");
+}
+
+static void test_topk_push() {
+    topk_init(topk_ptr, 3, sizeof(int), int_comparator);
+    topk_push_array(topk_ptr, vals, 6);
+    assert(topk_size(topk_ptr) == 3);
+    assert(topk_is_full(topk_ptr) == true);
+    topk_worst(topk_ptr, &rets[0]);
+    assert(rets[0] == 3);
+    topk_copy_to_array(topk_ptr, rets);
+    assert(rets[0] == 1 && rets[1] == 2 && rets[2] == 3);
+    topk_clear(topk_ptr);
+    assert(topk_size(topk_ptr) == 0);
+    topk_destroy(topk_ptr);
+    printf("test_topk_push passed!\n");
+}
+
+static void test_topk_largest() {
+    topk_init(topk_ptr, 100, sizeof(int), int_reverse_comparator);
+    for(int i = 0; i < 100000; i++) {
+        int val = (i * 7919) % 100000;
+        topk_push(topk_ptr, &val);
+    }
+    int* array = (int *) malloc(sizeof(int) * 100);
+    topk_copy_to_array(topk_ptr, array);
+    for(int i = 0; i < 100; i++) {
+        assert(array[i] == 99999 - i);
+    }
+    free(array);
+    array = NULL;
+    topk_destroy(topk_ptr);
+    printf("test_topk_largest passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_topk_init,
+        test_topk_push,
+        test_topk_largest
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    topk_ptr = (topk *) malloc(sizeof(topk));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(topk_ptr);
+    topk_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/unrolled_list.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+unrolled_list* list_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void assert_equals(const int* expected, size_t size) {
+    assert(unrolled_list_size(list_ptr) == size);
+    size_t offset = 0;
+    unrolled_list_for_each(val, list_ptr) {
+        assert(*(int *) val == expected[offset]);
+        offset++;
+    }
+    assert(offset == size);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_unrolled_list_init() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    assert(list_ptr->head == NULL);
+    assert(list_ptr->tail == NULL);
+    assert(list_ptr->size == 0);
+    assert(list_ptr->node_capacity >= UNROLLED_LIST_MIN_NODE_CAPACITY);
+    assert(unrolled_list_front(list_ptr) == NULL);
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_init passed!\n");
+}
+
+static void test_unrolled_list_push() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    unrolled_list_push_back(list_ptr, &vals[0]);
+    unrolled_list_push_back(list_ptr, &vals[1]);
+    unrolled_list_push_front(list_ptr, &vals[2]);
+    int expected[3] = {vals[2], vals[0], vals[1]};
+    assert_equals(expected, 3);
+    assert(*(int *) unrolled_list_front(list_ptr) == vals[2]);
+    assert(*(int *) unrolled_list_back(list_ptr) == vals[1]);
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_push passed!\n");
+}
+
+static void test_unrolled_list_at() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    for(int i = 0; i < 1000; i++) {
+        unrolled_list_push_back(list_ptr, &i);
+    }
+    for(int i = 0; i < 1000; i++) {
+        assert(*(int *) unrolled_list_at(list_ptr, i) == i);
+    }
+    assert(list_ptr->head->count == list_ptr->node_capacity);
+    assert(unrolled_list_index_of(list_ptr, &vals[0]) == 6);
+    int missing = 1000;
+    assert(unrolled_list_index_of(list_ptr, &missing) == -1);
+    int visited = 0;
+    unrolled_list_for_each(val, list_ptr) {
+        if (*(int *) val == 2)
+            break;
+        visited++;
+    }
+    assert(visited == 2);
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_at passed!\n");
+}
+
+static void test_unrolled_list_insert_at() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    int expected[2000];
+    size_t size = 0;
+    for(int i = 0; i < 2000; i++) {
+        size_t index = ((size_t) i * 7919) % (size + 1);
+        memmove(expected + index + 1, expected + index, sizeof(int) * (size - index));
+        expected[index] = i;
+        size++;
+        unrolled_list_insert_at(list_ptr, &i, index);
+    }
+    assert_equals(expected, size);
+    for(size_t i = 0; i < size; i++) {
+        assert(*(int *) unrolled_list_at(list_ptr, i) == expected[i]);
+    }
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_insert_at passed!\n");
+}
+
+static void test_unrolled_list_remove_at() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    int expected[2000];
+    size_t size = 2000;
+    for(int i = 0; i < 2000; i++) {
+        expected[i] = i;
+        unrolled_list_push_back(list_ptr, &i);
+    }
+    while(size > 0) {
+        size_t index = (2000 - size) * 7919 % size;
+        memmove(expected + index, expected + index + 1, sizeof(int) * (size - index - 1));
+        size--;
+        unrolled_list_remove_at(list_ptr, index);
+        if (size % 97 == 0) {
+            assert_equals(expected, size);
+        }
+    }
+    assert(unrolled_list_is_empty(list_ptr) == true);
+    assert(list_ptr->head == NULL && list_ptr->tail == NULL);
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_remove_at passed!\n");
+}
+
+static void test_unrolled_list_pop() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        unrolled_list_push_back(list_ptr, &vals[i]);
+    }
+    unrolled_list_pop_front(list_ptr);
+    unrolled_list_pop_back(list_ptr);
+    int expected[4] = {vals[1], vals[2], vals[3], vals[4]};
+    assert_equals(expected, 4);
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_pop passed!\n");
+}
+
+static void test_unrolled_list_copy_to_array() {
+    unrolled_list_init(list_ptr, sizeof(int));
+    for(int i = 0; i < 500; i++) {
+        unrolled_list_push_front(list_ptr, &i);
+    }
+    int* array = (int *) malloc(sizeof(int) * 500);
+    unrolled_list_copy_to_array(list_ptr, array);
+    for(int i = 0; i < 500; i++) {
+        assert(array[i] == 499 - i);
+    }
+    free(array);
+    array = NULL;
+    unrolled_list_clear(list_ptr);
+    printf("test_unrolled_list_copy_to_array passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_unrolled_list_init,
+        test_unrolled_list_push,
+        test_unrolled_list_at,
+        test_unrolled_list_insert_at,
+        test_unrolled_list_remove_at,
+        test_unrolled_list_pop,
+        test_unrolled_list_copy_to_array
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    list_ptr = (unrolled_list *) malloc(sizeof(unrolled_list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
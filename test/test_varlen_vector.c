@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/varlen_vector.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+varlen_vector* first_vector;
+varlen_vector* second_vector;
+const char* vals[6] = {"pear", "fig", "banana", "", "apple", "kiwi"};
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static void push_vals(varlen_vector* vector) {
+    for(size_t i = 0; i < 6; i++) {
+        varlen_vector_push_back(vector, vals[i], strlen(vals[i]));
+    }
+}
+
+static int string_comparator(const void* lhs, size_t lhs_length, const void* rhs, size_t rhs_length) {
+    size_t length = lhs_length < rhs_length ? lhs_length : rhs_length;
+    int cmp = length > 0 ? memcmp(lhs, rhs, length) : 0;
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (lhs_length > rhs_length) - (lhs_length < rhs_length);
+}
+
+static int length_comparator(const void* lhs, size_t lhs_length, const void* rhs, size_t rhs_length) {
+    return (lhs_length > rhs_length) - (lhs_length < rhs_length);
+}
+
+static bool equals(const varlen_vector* vector, size_t index, const char* val) {
+    size_t length;
+    const void* data = varlen_vector_at(vector, index, &length);
+    return length == strlen(val) && memcmp(data, val, length) == 0;
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_varlen_vector_init() {
+    varlen_vector_init(first_vector);
+    assert(first_vector->data != NULL);
+    assert(first_vector->offsets[0] == 0);
+    assert(first_vector->size == 0);
+    assert(first_vector->capacity == VARLEN_VECTOR_INIT_CAPACITY);
+    assert(first_vector->data_capacity == VARLEN_VECTOR_INIT_DATA_CAPACITY);
+    varlen_vector_destroy(first_vector);
+    printf("test_varlen_vector_init passed!\n");
+}
+
+static void test_varlen_vector_push_back() {
+    varlen_vector_init(first_vector);
+    push_vals(first_vector);
+    assert(varlen_vector_size(first_vector) == 6);
+    assert(varlen_vector_data_size(first_vector) == 22);
+    varlen_vector_for_each(index, first_vector) {
+        assert(equals(first_vector, index, vals[index]));
+        assert(varlen_vector_length(first_vector, index) == strlen(vals[index]));
+    }
+    varlen_vector_destroy(first_vector);
+    printf("test_varlen_vector_push_back passed!\n");
+}
+
+static void test_varlen_vector_grow() {
+    varlen_vector_init(first_vector);
+    char buffer[64];
+    for(int i = 0; i < 2000; i++) {
+        int length = snprintf(buffer, sizeof(buffer), "key-%d", i);
+        varlen_vector_push_back(first_vector, buffer, (size_t) length);
+    }
+    assert(varlen_vector_size(first_vector) == 2000);
+    assert(equals(first_vector, 1234, "key-1234"));
+    assert(varlen_vector_index_of(first_vector, "key-1999", 8) == 1999);
+    assert(varlen_vector_index_of(first_vector, "key-2000", 8) == -1);
+    varlen_vector_destroy(first_vector);
+    printf("test_varlen_vector_grow passed!\n");
+}
+
+static void test_varlen_vector_append() {
+    varlen_vector_init(first_vector);
+    varlen_vector_init(second_vector);
+    push_vals(first_vector);
+    push_vals(second_vector);
+    varlen_vector_append(first_vector, second_vector);
+    assert(varlen_vector_size(first_vector) == 12);
+    varlen_vector_for_each(index, first_vector) {
+        assert(equals(first_vector, index, vals[index % 6]));
+    }
+    varlen_vector_destroy(first_vector);
+    varlen_vector_destroy(second_vector);
+    printf("test_varlen_vector_append passed!\n");
+}
+
+static void test_varlen_vector_pop_back() {
+    varlen_vector_init(first_vector);
+    push_vals(first_vector);
+    varlen_vector_pop_back(first_vector);
+    varlen_vector_pop_back(first_vector);
+    assert(varlen_vector_size(first_vector) == 4);
+    assert(varlen_vector_data_size(first_vector) == 13);
+    varlen_vector_push_back(first_vector, "plum", 4);
+    assert(equals(first_vector, 4, "plum"));
+    varlen_vector_clear(first_vector);
+    assert(varlen_vector_is_empty(first_vector) == true);
+    varlen_vector_destroy(first_vector);
+    printf("test_varlen_vector_pop_back passed!\n");
+}
+
+static void test_varlen_vector_sort() {
+    varlen_vector_init(first_vector);
+    push_vals(first_vector);
+    varlen_vector_sort(first_vector, string_comparator);
+    const char* sorted[6] = {"", "apple", "banana", "fig", "kiwi", "pear"};
+    varlen_vector_for_each(index, first_vector) {
+        assert(equals(first_vector, index, sorted[index]));
+    }
+    varlen_vector_clear(first_vector);
+    push_vals(first_vector);
+    varlen_vector_sort(first_vector, length_comparator);
+    const char* stable[6] = {"", "fig", "pear", "kiwi", "apple", "banana"};
+    varlen_vector_for_each(index, first_vector) {
+        assert(equals(first_vector, index, stable[index]));
+    }
+    varlen_vector_destroy(first_vector);
+    printf("test_varlen_vector_sort passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_varlen_vector_init,
+        test_varlen_vector_push_back,
+        test_varlen_vector_grow,
+        test_varlen_vector_append,
+        test_varlen_vector_pop_back,
+        test_varlen_vector_sort
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    first_vector = (varlen_vector *) malloc(sizeof(varlen_vector));
+    second_vector = (varlen_vector *) malloc(sizeof(varlen_vector));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(first_vector);
+    first_vector = NULL;
+    free(second_vector);
+    second_vector = NULL;
+    return 0;
+}
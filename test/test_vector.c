@@ -335,6 +335,50 @@ static void test_vector_sort() {
     printf("test_vector_sort passed!\n");
 }
 
+static void test_vector_nth_element() {
+    vector_init(first_vector, sizeof(int));
+    for(int i = 0; i < 5000; i++) {
+        int val = (int) ((i * 2654435761u) % 1000u);
+        vector_push_back(first_vector, &val);
+    }
+    size_t positions[] = {0, 1, 2500, 4998, 4999};
+    for(size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+        size_t nth = positions[p];
+        vector_nth_element(first_vector, nth, int_comparator);
+        int* data = vector_get_data(first_vector);
+        for(size_t i = 0; i < first_vector->size; i++) {
+            assert(i <= nth ? data[i] <= data[nth] : data[i] >= data[nth]);
+        }
+    }
+    vector_destroy(first_vector);
+    vector_init(first_vector, sizeof(int));
+    vector_append_array(first_vector, vals, sizeof(vals) / sizeof(vals[0]));
+    vector_nth_element(first_vector, 2, int_comparator);
+    vector_at(first_vector, 2, &rets[0]);
+    assert(rets[0] == 3);
+    vector_destroy(first_vector);
+    printf("test_vector_nth_element passed!\n");
+}
+
+static void test_vector_partial_sort() {
+    vector_init(first_vector, sizeof(int));
+    for(int i = 0; i < 1000; i++) {
+        int val = 1000 - i;
+        vector_push_back(first_vector, &val);
+    }
+    vector_partial_sort(first_vector, 10, int_comparator);
+    int* data = vector_get_data(first_vector);
+    for(int i = 0; i < 10; i++) {
+        assert(data[i] == i + 1);
+    }
+    vector_partial_sort(first_vector, first_vector->size, int_comparator);
+    for(int i = 0; i < 1000; i++) {
+        assert(data[i] == i + 1);
+    }
+    vector_destroy(first_vector);
+    printf("test_vector_partial_sort passed!\n");
+}
+
 
 TestFunction test_functions[] = {
         test_vector_init,
@@ -362,7 +406,9 @@ TestFunction test_functions[] = {
         test_vector_copy_to_array,
         test_vector_swap,
         test_vector_get_data,
-        test_vector_sort
+        test_vector_sort,
+        test_vector_nth_element,
+        test_vector_partial_sort
 };
 
 int main(int argc, char** argv) {
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/view.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+view* views[4];
+vector* vector_ptr;
+list* list_ptr;
+int vals[6] = {6, 1, 5, 2, 4, 3};
+int rets[6];
+
+
+/** H E L P E R   F U N C T I O N S **/
+
+static bool is_odd(const void* val, void* context) {
+    return *(const int *) val % 2 != 0;
+}
+
+static void to_double(const void* val, void* dest, void* context) {
+    *(double *) dest = *(const int *) val * 1.5;
+}
+
+static void add_pair(const void* lhs, const void* rhs, void* dest, void* context) {
+    *(int *) dest = *(const int *) lhs + *(const int *) rhs;
+}
+
+static void sum(void* acc, const void* val, void* context) {
+    *(int *) acc += *(const int *) val;
+}
+
+static void fill_sources() {
+    vector_init(vector_ptr, sizeof(int));
+    vector_append_array(vector_ptr, vals, 6);
+    list_init(list_ptr, sizeof(int));
+    for(size_t i = 0; i < 6; i++) {
+        list_push_back(list_ptr, &vals[i]);
+    }
+}
+
+static void clear_sources() {
+    vector_destroy(vector_ptr);
+    list_clear(list_ptr);
+}
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_view_from_vector() {
+    fill_sources();
+    view_from_vector(views[0], vector_ptr);
+    size_t offset = 0;
+    view_for_each(val, views[0]) {
+        assert(*(const int *) val == vals[offset]);
+        offset++;
+    }
+    assert(offset == 6);
+    size_t count = 0;
+    if (offset == 0)
+        view_for_each(val, views[0])
+            count += 10;
+    if (offset == 6)
+        view_for_each(val, views[0])
+            count++;
+    else
+        count = 100;
+    assert(count == 6);
+    clear_sources();
+    printf("test_view_from_vector passed!\n");
+}
+
+static void test_view_from_list() {
+    fill_sources();
+    view_from_list(views[0], list_ptr);
+    assert(view_count(views[0]) == 6);
+    int total = 0;
+    view_reduce(views[0], &total, sum, NULL);
+    assert(total == 21);
+    clear_sources();
+    printf("test_view_from_list passed!\n");
+}
+
+static void test_view_filter() {
+    fill_sources();
+    view_from_list(views[0], list_ptr);
+    view_filter(views[1], views[0], is_odd, NULL);
+    vector_clear(vector_ptr);
+    view_collect(views[1], vector_ptr);
+    assert(vector_size(vector_ptr) == 3);
+    vector_copy_to_array(vector_ptr, rets);
+    assert(rets[0] == 1 && rets[1] == 5 && rets[2] == 3);
+    vector_destroy(vector_ptr);
+    list_clear(list_ptr);
+    printf("test_view_filter passed!\n");
+}
+
+static void test_view_transform() {
+    fill_sources();
+    view_from_vector(views[0], vector_ptr);
+    view_transform(views[1], views[0], sizeof(double), to_double, NULL);
+    size_t offset = 0;
+    view_for_each(val, views[1]) {
+        assert(*(const double *) val == vals[offset] * 1.5);
+        offset++;
+    }
+    assert(offset == 6);
+    view_destroy(views[1]);
+    clear_sources();
+    printf("test_view_transform passed!\n");
+}
+
+static void test_view_slice() {
+    fill_sources();
+    view_from_vector(views[0], vector_ptr);
+    view_slice(views[1], views[0], 2, 4);
+    view_from_list(views[2], list_ptr);
+    view_filter(views[3], views[2], is_odd, NULL);
+    assert(view_count(views[1]) == 2);
+    view_reset(views[1]);
+    assert(*(const int *) view_next(views[1]) == vals[2]);
+    assert(*(const int *) view_next(views[1]) == vals[3]);
+    assert(view_next(views[1]) == NULL);
+    view_take(views[1], views[3], 2);
+    assert(view_count(views[1]) == 2);
+    view_slice(views[1], views[0], 5, 100);
+    assert(view_count(views[1]) == 1);
+    clear_sources();
+    printf("test_view_slice passed!\n");
+}
+
+static void test_view_zip() {
+    fill_sources();
+    view_from_vector(views[0], vector_ptr);
+    view_from_list(views[1], list_ptr);
+    view_take(views[2], views[1], 4);
+    view_zip(views[3], views[0], views[2], sizeof(int), add_pair, NULL);
+    size_t offset = 0;
+    view_for_each(val, views[3]) {
+        assert(*(const int *) val == vals[offset] * 2);
+        offset++;
+    }
+    assert(offset == 4);
+    view_destroy(views[3]);
+    clear_sources();
+    printf("test_view_zip passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_view_from_vector,
+        test_view_from_list,
+        test_view_filter,
+        test_view_transform,
+        test_view_slice,
+        test_view_zip
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    size_t views_size = sizeof(views) / sizeof(views[0]);
+    for(size_t i = 0; i < views_size; i++) {
+        views[i] = (view *) malloc(sizeof(view));
+    }
+    vector_ptr = (vector *) malloc(sizeof(vector));
+    list_ptr = (list *) malloc(sizeof(list));
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    for(size_t i = 0; i < views_size; i++) {
+        free(views[i]);
+        views[i] = NULL;
+    }
+    free(vector_ptr);
+    vector_ptr = NULL;
+    free(list_ptr);
+    list_ptr = NULL;
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdbool.h>
+
+#include "../src/xor_filter.h"
+
+/* Pointer Functions */
+typedef void (* TestFunction) ();
+
+/* Global Variables */
+xor_filter* filter_ptr;
+vector* vector_ptr;
+int absent[100000];
+
+
+/** T E S T   F U N C T I O N S **/
+
+static void test_xor_filter_init() {
+    int vals[6] = {1, 2, 4, 4, 8, 16};
+    xor_filter_init(filter_ptr, vals, 6, sizeof(int));
+    assert(xor_filter_size(filter_ptr) == 5);
+    for(size_t i = 0; i < 6; i++) {
+        assert(xor_filter_may_contain(filter_ptr, &vals[i]) == true);
+    }
+    xor_filter_destroy(filter_ptr);
+    xor_filter_init(filter_ptr, NULL, 0, sizeof(int));
+    assert(xor_filter_false_positive_rate(filter_ptr, absent, 100000) < 0.01);
+    xor_filter_destroy(filter_ptr);
+    printf("test_xor_filter_init passed!\n");
+}
+
+static void test_xor_filter_may_contain() {
+    vector_init(vector_ptr, sizeof(int));
+    for(int i = 0; i < 100000; i++) {
+        vector_push_back(vector_ptr, &i);
+    }
+    xor_filter_from_vector(filter_ptr, vector_ptr);
+    assert(xor_filter_size(filter_ptr) == 100000);
+    assert(xor_filter_memory_size(filter_ptr) < 100000 * 10 / 8 + 64);
+    for(int i = 0; i < 100000; i++) {
+        assert(xor_filter_may_contain(filter_ptr, &i) == true);
+    }
+    double rate = xor_filter_false_positive_rate(filter_ptr, absent, 100000);
+    assert(rate > 0.001 && rate < 0.008);
+    xor_filter_destroy(filter_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_xor_filter_may_contain passed!\n");
+}
+
+static void test_xor_filter_vector_index_of() {
+    vector_init(vector_ptr, sizeof(int));
+    for(int i = 0; i < 5000; i++) {
+        int val = 2 * i;
+        vector_push_back(vector_ptr, &val);
+    }
+    xor_filter_from_vector(filter_ptr, vector_ptr);
+    for(int i = 0; i < 5000; i++) {
+        int val = 2 * i;
+        assert(xor_filter_vector_index_of(filter_ptr, vector_ptr, &val) == i);
+        val = 2 * i + 1;
+        assert(xor_filter_vector_index_of(filter_ptr, vector_ptr, &val) == -1);
+    }
+    xor_filter_destroy(filter_ptr);
+    vector_destroy(vector_ptr);
+    printf("test_xor_filter_vector_index_of passed!\n");
+}
+
+TestFunction test_functions[] = {
+        test_xor_filter_init,
+        test_xor_filter_may_contain,
+        test_xor_filter_vector_index_of
+};
+
+int main(int argc, char** argv) {
+    size_t tests_size = sizeof(test_functions) / sizeof(TestFunction);
+    filter_ptr = (xor_filter *) malloc(sizeof(xor_filter));
+    vector_ptr = (vector *) malloc(sizeof(vector));
+    for(int i = 0; i < 100000; i++) {
+        absent[i] = -1 - i;
+    }
+    for(size_t i = 0; i < tests_size; i++) {
+        test_functions[i]();
+    }
+    printf("\033[0;32mAll tests passed!\n");
+    free(filter_ptr);
+    filter_ptr = NULL;
+    free(vector_ptr);
+    vector_ptr = NULL;
+    return 0;
+}